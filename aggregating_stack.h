@@ -0,0 +1,296 @@
+#ifndef AGGREGATING_STACK_H
+#define AGGREGATING_STACK_H
+
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "stack.h"
+#include "stack_format.h"
+
+/**
+ * @brief Monoidi predefiniti per AggregatingStack e WindowAggregator
+ *
+ * Un monoide è un funtore (come i predicati di checkif) con un'operazione associativa
+ * T operator()(const T& a, const T& b) const e il suo elemento neutro T identity() const,
+ * restituito da aggregate() quando non ci sono elementi. L'operazione non deve essere
+ * commutativa: gli elementi vengono combinati nell'ordine indicato dallo stack.
+*/
+template <typename T>
+struct StackSum {
+    T identity() const {
+        return T();
+    }
+
+    T operator()(const T& a, const T& b) const {
+        return a + b;
+    }
+};
+
+template <typename T>
+struct StackMin {
+    T identity() const {
+        return std::numeric_limits<T>::max();
+    }
+
+    T operator()(const T& a, const T& b) const {
+        return b < a ? b : a;
+    }
+};
+
+template <typename T>
+struct StackMax {
+    T identity() const {
+        return std::numeric_limits<T>::lowest();
+    }
+
+    T operator()(const T& a, const T& b) const {
+        return a < b ? b : a;
+    }
+};
+
+template <typename T>
+struct StackGcd {
+    static_assert(std::is_integral<T>::value, "StackGcd: T deve essere un tipo intero");
+
+    T identity() const {
+        return T(0);
+    }
+
+    T operator()(const T& a, const T& b) const {
+        return std::gcd(a, b);
+    }
+};
+
+/**
+ * @brief Stack che mantiene l'aggregato (secondo il monoide Monoid) di tutti i suoi elementi
+ *
+ * Ogni cella contiene l'elemento e l'aggregato di tutte le celle fino a essa, quindi
+ * push, pop e aggregate() sono O(1) invece di ricalcolare min/max/somma su tutto lo stack.
+ * Le celle stanno in uno Stack, da cui vengono capacità, crescita e savepoint.
+ *
+ * Order dice in che ordine gli elementi entrano nell'aggregato: BottomUp combina dal fondo
+ * alla cima (fondo ⊕ ... ⊕ cima), TopDown dalla cima al fondo. Per un monoide commutativo
+ * i due ordini danno lo stesso risultato.
+*/
+template <typename T, typename Monoid, StackOrder Order = StackOrder::BottomUp>
+class AggregatingStack {
+
+private:
+
+    struct Cell {
+        T value;
+        T agg;      // aggregato delle celle dal fondo fino a questa
+    };
+
+    Stack<Cell> cells_;
+    Monoid monoid_;
+
+    template <typename U>
+    void push_cell(U&& value) {
+        if (cells_.empty()) {
+            T agg(value);
+            cells_.push(Cell{std::forward<U>(value), std::move(agg)});
+        }
+        else {
+            const T& prev = cells_.top().agg;
+            T agg = Order == StackOrder::BottomUp ? monoid_(prev, value) : monoid_(value, prev);
+            cells_.push(Cell{std::forward<U>(value), std::move(agg)});
+        }
+    }
+
+public:
+    typedef T value_type;
+
+    /**
+     * @brief Costruttore di default (stack vuoto con crescita Geometric)
+    */
+    AggregatingStack() : cells_(0, StackGrowth::Geometric), monoid_() {}
+
+    /**
+     * @brief Costruttore con dimensione massima, come per Stack
+     *
+     * @param max_size massima dimensione dello stack (capacità iniziale se growth è Geometric)
+     * @param growth politica di crescita dello stack (di default Fixed)
+     * @param monoid monoide con cui aggregare gli elementi
+    */
+    explicit AggregatingStack(unsigned int max_size, StackGrowth growth = StackGrowth::Fixed, const Monoid& monoid = Monoid())
+        : cells_(max_size, growth), monoid_(monoid) {}
+
+    /**
+     * @brief Metodo per inserire un elemento in cima aggiornando l'aggregato in O(1)
+     *
+     * @param value valore da inserire
+     *
+     * @throw std::length_error se lo stack (Fixed) è pieno
+    */
+    void push(const T& value) {
+        push_cell(value);
+    }
+
+    void push(T&& value) {
+        push_cell(std::move(value));
+    }
+
+    /**
+     * @brief Metodo per rimuovere l'elemento in cima e restituirlo (l'aggregato torna quello precedente)
+     *
+     * @throw std::length_error se lo stack è vuoto
+    */
+    T pop() {
+        return std::move(cells_.pop_value().value);
+    }
+
+    const T& top() const {
+        return cells_.top().value;
+    }
+
+    /**
+     * @brief Metodo che restituisce l'aggregato di tutti gli elementi in O(1)
+     *
+     * @return T aggregato, o monoid.identity() se lo stack è vuoto
+    */
+    T aggregate() const {
+        if (cells_.empty())
+            return monoid_.identity();
+        return cells_.top().agg;
+    }
+
+    const Monoid& monoid() const {
+        return monoid_;
+    }
+
+    void clear() {
+        cells_.clear();
+    }
+
+    bool empty() const {
+        return cells_.empty();
+    }
+
+    bool full() const {
+        return cells_.full();
+    }
+
+    unsigned int size() const {
+        return cells_.size();
+    }
+
+    unsigned int max_size() const {
+        return cells_.max_size();
+    }
+
+    void reserve(unsigned int n) {
+        cells_.reserve(n);
+    }
+
+    /**
+     * @brief Savepoint: dopo rollback_to() l'aggregato è di nuovo quello del mark
+    */
+    StackMark mark() const {
+        return cells_.mark();
+    }
+
+    void rollback_to(StackMark m) {
+        cells_.rollback_to(m);
+    }
+};
+
+/**
+ * @brief Aggregato su una finestra scorrevole (FIFO) realizzato con due AggregatingStack
+ *
+ * I nuovi elementi entrano nello stack di ingresso (aggregato BottomUp); quando serve il
+ * più vecchio, l'ingresso viene travasato tutto nello stack di uscita (aggregato TopDown),
+ * che restituisce gli elementi in ordine di arrivo. Ogni elemento viene travasato una
+ * volta sola, quindi push, pop e aggregate() sono O(1) ammortizzati; l'aggregato
+ * rispetta l'ordine di arrivo anche per monoidi non commutativi.
+*/
+template <typename T, typename Monoid>
+class WindowAggregator {
+
+private:
+    AggregatingStack<T, Monoid, StackOrder::BottomUp> in_;
+    AggregatingStack<T, Monoid, StackOrder::TopDown> out_;
+    Monoid monoid_;
+
+    void transfer() {
+        out_.reserve(in_.size());
+        while (!in_.empty()) {
+            out_.push(in_.pop());
+        }
+    }
+
+public:
+    typedef T value_type;
+
+    explicit WindowAggregator(const Monoid& monoid = Monoid())
+        : in_(0, StackGrowth::Geometric, monoid), out_(0, StackGrowth::Geometric, monoid), monoid_(monoid) {}
+
+    /**
+     * @brief Metodo per inserire l'elemento più recente nella finestra
+    */
+    void push(const T& value) {
+        in_.push(value);
+    }
+
+    void push(T&& value) {
+        in_.push(std::move(value));
+    }
+
+    /**
+     * @brief Metodo per togliere dalla finestra l'elemento più vecchio e restituirlo
+     *
+     * @throw std::length_error se la finestra è vuota
+    */
+    T pop() {
+        if (out_.empty()) {
+            if (in_.empty())
+                throw std::length_error("WindowAggregator underflow in pop (window empty)");
+            transfer();
+        }
+        return out_.pop();
+    }
+
+    /**
+     * @brief Metodo che restituisce l'elemento più vecchio (può travasare l'ingresso)
+     *
+     * @throw std::length_error se la finestra è vuota
+    */
+    const T& front() {
+        if (out_.empty()) {
+            if (in_.empty())
+                throw std::length_error("WindowAggregator underflow in front (window empty)");
+            transfer();
+        }
+        return out_.top();
+    }
+
+    /**
+     * @brief Metodo che restituisce l'aggregato della finestra, dal più vecchio al più recente
+     *
+     * @return T aggregato, o monoid.identity() se la finestra è vuota
+    */
+    T aggregate() const {
+        if (out_.empty())
+            return in_.aggregate();
+        if (in_.empty())
+            return out_.aggregate();
+        return monoid_(out_.aggregate(), in_.aggregate());
+    }
+
+    void clear() {
+        in_.clear();
+        out_.clear();
+    }
+
+    bool empty() const {
+        return in_.empty() && out_.empty();
+    }
+
+    unsigned int size() const {
+        return in_.size() + out_.size();
+    }
+};
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Impedisce al compilatore di eliminare un calcolo il cui risultato non viene usato
+*/
+template <typename T>
+inline void bench_keep(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Risultato di un caso del benchmark (tempi in ns per operazione)
+*/
+struct BenchResult {
+    std::string name;
+    std::string type;
+    std::string container;
+    unsigned long long ops;
+    int repetitions;
+    double min;
+    double mean;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+};
+
+/**
+ * @brief Harness dei microbenchmark: riscaldamento, ripetizioni, percentili, CSV/JSON
+ *
+ * Ogni caso è una funzione che esegue ops operazioni e viene chiamata warmup volte
+ * senza misurare, poi repetitions volte misurando ciascuna chiamata con steady_clock.
+ * I percentili sono calcolati sui tempi per operazione delle ripetizioni.
+ *
+ * Opzioni da riga di comando: --csv | --json, --reps N, --warmup N, --filter testo
+*/
+class BenchHarness {
+
+public:
+    enum class Format { Csv, Json };
+
+    BenchHarness(int argc, char** argv) : format_(Format::Csv), repetitions_(30), warmup_(3) {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--json") == 0)
+                format_ = Format::Json;
+            else if (std::strcmp(argv[i], "--csv") == 0)
+                format_ = Format::Csv;
+            else if (std::strcmp(argv[i], "--reps") == 0 && i + 1 < argc)
+                repetitions_ = std::max(1, std::atoi(argv[++i]));
+            else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+                warmup_ = std::max(0, std::atoi(argv[++i]));
+            else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+                filter_ = argv[++i];
+        }
+    }
+
+    /**
+     * @brief Esegue un caso e ne registra il risultato
+     *
+     * @param name operazione misurata (push, pop, ...)
+     * @param type tipo degli elementi
+     * @param container contenitore misurato
+     * @param ops numero di operazioni eseguite da una chiamata di f
+     * @param f funzione da misurare
+    */
+    template <typename F>
+    void run(const std::string& name, const std::string& type, const std::string& container,
+             unsigned long long ops, F f) {
+        run(name, type, container, ops, [] {}, f);
+    }
+
+    /**
+     * @brief Esegue un caso con una preparazione non misurata prima di ogni chiamata
+     *
+     * @param setup funzione chiamata prima di ogni esecuzione di f, fuori dalla misura
+    */
+    template <typename S, typename F>
+    void run(const std::string& name, const std::string& type, const std::string& container,
+             unsigned long long ops, S setup, F f) {
+        if (!filter_.empty() && (name + "/" + type + "/" + container).find(filter_) == std::string::npos)
+            return;
+        for (int i = 0; i < warmup_; ++i) {
+            setup();
+            f();
+        }
+        std::vector<double> samples(repetitions_);
+        for (int i = 0; i < repetitions_; ++i) {
+            setup();
+            auto inizio = std::chrono::steady_clock::now();
+            f();
+            auto fine = std::chrono::steady_clock::now();
+            samples[i] = std::chrono::duration<double, std::nano>(fine - inizio).count() / ops;
+        }
+        std::sort(samples.begin(), samples.end());
+        double sum = 0;
+        for (double x : samples) {
+            sum += x;
+        }
+        results_.push_back(BenchResult{name, type, container, ops, repetitions_, samples.front(),
+                                       sum / samples.size(), percentile(samples, 50),
+                                       percentile(samples, 90), percentile(samples, 99), samples.back()});
+    }
+
+    /**
+     * @brief Stampa tutti i risultati nel formato scelto
+    */
+    void report(std::ostream& os) const {
+        if (format_ == Format::Csv) {
+            os << "name,type,container,ops,reps,min_ns,mean_ns,p50_ns,p90_ns,p99_ns,max_ns\n";
+            for (const BenchResult& r : results_) {
+                os << r.name << ',' << r.type << ',' << r.container << ',' << r.ops << ',' << r.repetitions
+                   << ',' << r.min << ',' << r.mean << ',' << r.p50 << ',' << r.p90 << ',' << r.p99
+                   << ',' << r.max << '\n';
+            }
+        }
+        else {
+            os << "[\n";
+            for (std::size_t i = 0; i < results_.size(); ++i) {
+                const BenchResult& r = results_[i];
+                os << "  {\"name\": \"" << r.name << "\", \"type\": \"" << r.type << "\", \"container\": \""
+                   << r.container << "\", \"ops\": " << r.ops << ", \"reps\": " << r.repetitions
+                   << ", \"min_ns\": " << r.min << ", \"mean_ns\": " << r.mean << ", \"p50_ns\": " << r.p50
+                   << ", \"p90_ns\": " << r.p90 << ", \"p99_ns\": " << r.p99 << ", \"max_ns\": " << r.max
+                   << "}" << (i + 1 < results_.size() ? "," : "") << '\n';
+            }
+            os << "]\n";
+        }
+    }
+
+    const std::vector<BenchResult>& results() const {
+        return results_;
+    }
+
+private:
+    Format format_;
+    int repetitions_;
+    int warmup_;
+    std::string filter_;
+    std::vector<BenchResult> results_;
+
+    /**
+     * @brief Percentile p (0-100) di un campione ordinato, con interpolazione lineare
+    */
+    static double percentile(const std::vector<double>& sorted, double p) {
+        double pos = p / 100.0 * (sorted.size() - 1);
+        std::size_t i = static_cast<std::size_t>(pos);
+        if (i + 1 >= sorted.size())
+            return sorted.back();
+        return sorted[i] + (pos - i) * (sorted[i + 1] - sorted[i]);
+    }
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <chrono>
+#include <memory_resource>
+#include "stack.h"
+#include "custom.h"
+
+/**
+ * @brief Benchmark: stack di breve durata allocati con new globale vs arena std::pmr
+ *
+ * Ogni "richiesta" crea e distrugge molti stack piccoli con lo stesso schema
+ * push/pop dei test di main.cpp. Con l'arena la memoria viene rilasciata
+ * in un colpo solo alla fine della richiesta.
+*/
+
+const int RICHIESTE = 200;
+const int STACK_PER_RICHIESTA = 5000;
+const unsigned int CAPACITA = 16;
+const int ELEMENTI = 10;
+
+/**
+ * @brief Schema push/pop su uno stack di interi (come testSvuotamento/testCheckif)
+*/
+template <typename S>
+long long usaStackInt(S &s) {
+    long long somma = 0;
+    for (int i = 0; i < ELEMENTI; ++i) {
+        s.push(i);
+    }
+    while (!s.empty()) {
+        somma += s.pop();
+    }
+    return somma;
+}
+
+/**
+ * @brief Schema emplace/pop su uno stack di userCustom
+*/
+template <typename S>
+long long usaStackUser(S &s) {
+    long long somma = 0;
+    for (int i = 0; i < ELEMENTI; ++i) {
+        s.emplace("Mario", i);
+    }
+    while (!s.empty()) {
+        somma += s.pop_value().getAge();
+    }
+    return somma;
+}
+
+/**
+ * @brief Esegue la funzione f e stampa i ns per stack creato
+*/
+template <typename F>
+void misura(const char *nome, F f) {
+    auto inizio = std::chrono::steady_clock::now();
+    long long check = f();
+    auto fine = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(fine - inizio).count();
+    std::cout << nome << ": " << ns / (double(RICHIESTE) * STACK_PER_RICHIESTA)
+              << " ns/stack (check " << check << ")" << std::endl;
+}
+
+int main() {
+    misura("int, new globale", [] {
+        long long check = 0;
+        for (int r = 0; r < RICHIESTE; ++r) {
+            for (int i = 0; i < STACK_PER_RICHIESTA; ++i) {
+                Stack<int> s(CAPACITA);
+                check += usaStackInt(s);
+            }
+        }
+        return check;
+    });
+
+    misura("int, arena monotonic", [] {
+        long long check = 0;
+        static char buffer[STACK_PER_RICHIESTA * CAPACITA * sizeof(int) + 4096];
+        for (int r = 0; r < RICHIESTE; ++r) {
+            std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+            for (int i = 0; i < STACK_PER_RICHIESTA; ++i) {
+                PmrStack<int> s(CAPACITA, StackGrowth::Fixed, &arena);
+                check += usaStackInt(s);
+            }
+        }
+        return check;
+    });
+
+    misura("int, pool unsynchronized", [] {
+        long long check = 0;
+        for (int r = 0; r < RICHIESTE; ++r) {
+            std::pmr::unsynchronized_pool_resource pool;
+            for (int i = 0; i < STACK_PER_RICHIESTA; ++i) {
+                PmrStack<int> s(CAPACITA, StackGrowth::Fixed, &pool);
+                check += usaStackInt(s);
+            }
+        }
+        return check;
+    });
+
+    misura("userCustom, new globale", [] {
+        long long check = 0;
+        for (int r = 0; r < RICHIESTE; ++r) {
+            for (int i = 0; i < STACK_PER_RICHIESTA; ++i) {
+                Stack<userCustom> s(CAPACITA);
+                check += usaStackUser(s);
+            }
+        }
+        return check;
+    });
+
+    misura("userCustom, arena monotonic", [] {
+        long long check = 0;
+        static char buffer[STACK_PER_RICHIESTA * CAPACITA * sizeof(userCustom) + 4096];
+        for (int r = 0; r < RICHIESTE; ++r) {
+            std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+            for (int i = 0; i < STACK_PER_RICHIESTA; ++i) {
+                PmrStack<userCustom> s(CAPACITA, StackGrowth::Fixed, &arena);
+                check += usaStackUser(s);
+            }
+        }
+        return check;
+    });
+
+    return 0;
+}
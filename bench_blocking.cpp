@@ -0,0 +1,122 @@
+#include <iostream>
+#include <chrono>
+#include <ctime>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "stack.h"
+#include "blocking_stack.h"
+
+/**
+ * @brief Benchmark produttore/consumatore: BlockingStack contro Stack + mutex con ritentativi
+ *
+ * P produttori inseriscono ELEMENTI valori in totale in uno stack di capacità CAPACITA,
+ * altrettanti consumatori li estraggono. La soluzione attuale riprova push() e pop() finché
+ * non smettono di lanciare std::length_error; BlockingStack fa dormire i thread in attesa.
+ * Per ogni numero di thread vengono stampati il tempo reale e il tempo di CPU del processo
+ * (il tempo bruciato nei ritentativi).
+*/
+
+const int ELEMENTI = 1000000;
+const unsigned int CAPACITA = 64;
+
+/**
+ * @brief Stack protetto da un mutex che segnala pieno/vuoto con eccezioni (la soluzione attuale)
+*/
+class RetryStack {
+
+public:
+    RetryStack() : s_(CAPACITA) {}
+
+    void push(int v) {
+        for (;;) {
+            try {
+                std::lock_guard<std::mutex> lock(m_);
+                s_.push(v);
+                return;
+            } catch (std::length_error &) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    int pop() {
+        for (;;) {
+            try {
+                std::lock_guard<std::mutex> lock(m_);
+                return s_.pop();
+            } catch (std::length_error &) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    std::mutex m_;
+    Stack<int> s_;
+};
+
+/**
+ * @brief Adattatore di BlockingStack alla stessa interfaccia
+*/
+class Bloccante {
+
+public:
+    Bloccante() : s_(CAPACITA) {}
+
+    void push(int v) {
+        s_.push(v);
+    }
+
+    int pop() {
+        return *s_.pop();
+    }
+
+private:
+    BlockingStack<int> s_;
+};
+
+/**
+ * @brief Esegue il carico con coppie produttore/consumatore e stampa tempo reale e di CPU (ms)
+*/
+template <typename S>
+void misura(const char *nome, int coppie) {
+    S s;
+    long long somma = 0;
+    std::mutex m;
+    std::vector<std::thread> pool;
+    std::clock_t cpu_inizio = std::clock();
+    auto inizio = std::chrono::steady_clock::now();
+    for (int t = 0; t < coppie; ++t) {
+        pool.emplace_back([&s, coppie] {
+            for (int i = 0; i < ELEMENTI / coppie; ++i) {
+                s.push(i);
+            }
+        });
+        pool.emplace_back([&s, &somma, &m, coppie] {
+            long long parziale = 0;
+            for (int i = 0; i < ELEMENTI / coppie; ++i) {
+                parziale += s.pop();
+            }
+            std::lock_guard<std::mutex> lock(m);
+            somma += parziale;
+        });
+    }
+    for (std::thread &th : pool) {
+        th.join();
+    }
+    auto fine = std::chrono::steady_clock::now();
+    double cpu = 1000.0 * (std::clock() - cpu_inizio) / CLOCKS_PER_SEC;
+    double reale = std::chrono::duration<double, std::milli>(fine - inizio).count();
+    std::cout << coppie << "," << nome << "," << reale << "," << cpu << "," << somma << std::endl;
+}
+
+int main() {
+    std::cout << "coppie,stack,reale ms,cpu ms,checksum" << std::endl;
+    for (int coppie = 1; coppie <= 8; coppie *= 2) {
+        misura<RetryStack>("Stack+retry", coppie);
+        misura<Bloccante>("BlockingStack", coppie);
+    }
+    return 0;
+}
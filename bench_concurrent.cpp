@@ -0,0 +1,77 @@
+#include <iostream>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "stack.h"
+#include "concurrent_stack.h"
+
+/**
+ * @brief Benchmark: ConcurrentStack lock-free vs Stack protetto da std::mutex, da 1 a 64 thread
+ *
+ * Ogni thread esegue OPERAZIONI coppie push/pop sullo stesso stack.
+ * Viene stampato il throughput totale in milioni di operazioni al secondo.
+*/
+
+const int OPERAZIONI = 200000;
+
+/**
+ * @brief Stack protetto da un mutex (la soluzione attuale da confrontare)
+*/
+class MutexStack {
+
+public:
+    MutexStack() : s_(1024, StackGrowth::Geometric) {}
+
+    void push(int v) {
+        std::lock_guard<std::mutex> lock(m_);
+        s_.push(v);
+    }
+
+    bool try_pop(int &out) {
+        std::lock_guard<std::mutex> lock(m_);
+        if (s_.empty())
+            return false;
+        out = s_.pop_value();
+        return true;
+    }
+
+private:
+    std::mutex m_;
+    Stack<int> s_;
+};
+
+/**
+ * @brief Esegue il carico con il numero di thread specificato e ritorna Mop/s
+*/
+template <typename S>
+double misura(int threads) {
+    S s;
+    std::vector<std::thread> pool;
+    auto inizio = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&s] {
+            int v;
+            for (int i = 0; i < OPERAZIONI; ++i) {
+                s.push(i);
+                s.try_pop(v);
+            }
+        });
+    }
+    for (std::thread &th : pool) {
+        th.join();
+    }
+    auto fine = std::chrono::steady_clock::now();
+    double secondi = std::chrono::duration<double>(fine - inizio).count();
+    return 2.0 * OPERAZIONI * threads / secondi / 1e6;
+}
+
+int main() {
+    std::cout << "thread,lock-free Mop/s,mutex Mop/s" << std::endl;
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        double lockfree = misura<ConcurrentStack<int>>(threads);
+        double mutex = misura<MutexStack>(threads);
+        std::cout << threads << "," << lockfree << "," << mutex << std::endl;
+    }
+    return 0;
+}
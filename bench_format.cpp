@@ -0,0 +1,65 @@
+#include <iostream>
+#include <chrono>
+#include <fstream>
+#include "stack.h"
+#include "custom.h"
+#include "stack_format.h"
+
+/**
+ * @brief Benchmark: stampa di stack grandi con operator<< vs StackFormatter
+ *
+ * Ogni stack viene scritto su un file (di default /dev/null) più volte.
+ * operator<< passa ogni elemento dallo stream (locale, sentry, ...);
+ * StackFormatter scrive nel proprio buffer con std::to_chars e fa una sola write.
+*/
+
+const unsigned int ELEMENTI = 10000000;
+const unsigned int ELEMENTI_USER = 1000000;
+const int RIPETIZIONI = 3;
+
+/**
+ * @brief Esegue f RIPETIZIONI volte e ritorna il tempo medio in ms
+*/
+template <typename F>
+double misura(F f) {
+    auto inizio = std::chrono::steady_clock::now();
+    for (int r = 0; r < RIPETIZIONI; ++r) {
+        f();
+    }
+    auto fine = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(fine - inizio).count() / RIPETIZIONI;
+}
+
+/**
+ * @brief Confronta operator<< e StackFormatter sullo stesso stack
+*/
+template <typename S>
+void confronta(const char *nome, std::ostream &out, StackFormatter &f, const S &s) {
+    double stream = misura([&] { out << s; });
+    double formatter = misura([&] { f.write(out, s); });
+    std::cout << nome << "," << s.size() << "," << stream << "," << formatter << ","
+              << stream / formatter << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::ofstream out(argc > 1 ? argv[1] : "/dev/null", std::ios::binary);
+
+    Stack<int> interi(ELEMENTI);
+    Stack<double> reali(ELEMENTI);
+    for (unsigned int i = 0; i < ELEMENTI; ++i) {
+        interi.push(static_cast<int>(i * 2654435761u));
+        reali.push(i * 0.001);
+    }
+    Stack<userCustom> utenti(ELEMENTI_USER);
+    for (unsigned int i = 0; i < ELEMENTI_USER; ++i) {
+        utenti.push(userCustom("utente", i % 100));
+    }
+
+    StackFormatter f;
+    std::cout << "tipo,elementi,operator<< ms,StackFormatter ms,speedup" << std::endl;
+    confronta("int", out, f, interi);
+    confronta("double", out, f, reali);
+    confronta("userCustom", out, f, utenti);
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include <iostream>
+#include <queue>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "stack_queue.h"
+#include "aggregating_stack.h"
+#include "custom.h"
+
+/**
+ * @brief Benchmark di StackQueue<T> (due Stack) contro std::queue<T> (std::deque)
+ *
+ * - burst: N inserimenti e poi N prelievi su una coda nuova (allocazioni comprese)
+ * - steady: coda con 1024 elementi, N volte un inserimento e un prelievo (coda a regime)
+ * - batch: blocchi di 64 elementi inseriti e prelevati insieme (push_range/pop_n)
+ * - window: somma su una finestra di 1024 elementi; std::queue la aggiorna a mano (sottraendo
+ *   l'uscente, possibile solo per la somma), WindowAggregator con il monoide StackSum
+ *
+ * I prelievi spostano fuori l'elemento in entrambi i casi (pop() di StackQueue lo restituisce).
+ *
+ * Uso: bench_queue.exe [--csv | --json] [--reps N] [--warmup N] [--filter testo]
+*/
+
+const unsigned int N = 1000000;
+const unsigned int FINESTRA = 1024;
+const unsigned int BLOCCO = 64;
+
+inline int elemento(int, unsigned int i) {
+    return static_cast<int>(i);
+}
+
+inline userCustom elemento(userCustom, unsigned int i) {
+    return userCustom("utente", i % 100);
+}
+
+inline long long chiave(int x) {
+    return x;
+}
+
+inline long long chiave(const userCustom &x) {
+    return x.getAge();
+}
+
+/**
+ * @brief Registra tutti i casi per il tipo T
+*/
+template <typename T>
+void casi(BenchHarness &h, const std::string &tipo) {
+    std::vector<T> sorgente;
+    for (unsigned int i = 0; i < N; ++i) {
+        sorgente.push_back(elemento(T(), i));
+    }
+    long long check = 0;
+
+    h.run("burst", tipo, "StackQueue", 2ULL * N, [&] {
+        StackQueue<T> q;
+        for (unsigned int i = 0; i < N; ++i) {
+            q.push(sorgente[i]);
+        }
+        while (!q.empty()) {
+            check += chiave(q.pop());
+        }
+    });
+    h.run("burst", tipo, "std::queue", 2ULL * N, [&] {
+        std::queue<T> q;
+        for (unsigned int i = 0; i < N; ++i) {
+            q.push(sorgente[i]);
+        }
+        while (!q.empty()) {
+            T x(std::move(q.front()));
+            q.pop();
+            check += chiave(x);
+        }
+    });
+
+    h.run("steady", tipo, "StackQueue", 2ULL * N, [&] {
+        StackQueue<T> q;
+        for (unsigned int i = 0; i < FINESTRA; ++i) {
+            q.push(sorgente[i]);
+        }
+        for (unsigned int i = 0; i < N; ++i) {
+            q.push(sorgente[i]);
+            check += chiave(q.pop());
+        }
+    });
+    h.run("steady", tipo, "std::queue", 2ULL * N, [&] {
+        std::queue<T> q;
+        for (unsigned int i = 0; i < FINESTRA; ++i) {
+            q.push(sorgente[i]);
+        }
+        for (unsigned int i = 0; i < N; ++i) {
+            q.push(sorgente[i]);
+            T x(std::move(q.front()));
+            q.pop();
+            check += chiave(x);
+        }
+    });
+
+    std::vector<T> uscita(BLOCCO);
+    h.run("batch", tipo, "StackQueue", 2ULL * N, [&] {
+        StackQueue<T> q;
+        for (unsigned int i = 0; i + BLOCCO <= N; i += BLOCCO) {
+            q.push_range(sorgente.begin() + i, sorgente.begin() + i + BLOCCO);
+            q.pop_n(BLOCCO, uscita.begin());
+            check += chiave(uscita[0]);
+        }
+    });
+    h.run("batch", tipo, "std::queue", 2ULL * N, [&] {
+        std::queue<T> q;
+        for (unsigned int i = 0; i + BLOCCO <= N; i += BLOCCO) {
+            for (unsigned int j = i; j < i + BLOCCO; ++j) {
+                q.push(sorgente[j]);
+            }
+            for (unsigned int j = 0; j < BLOCCO; ++j) {
+                uscita[j] = std::move(q.front());
+                q.pop();
+            }
+            check += chiave(uscita[0]);
+        }
+    });
+
+    bench_keep(check);
+}
+
+/**
+ * @brief Somma su una finestra scorrevole di interi
+*/
+void casi_finestra(BenchHarness &h) {
+    std::vector<long long> sorgente;
+    for (unsigned int i = 0; i < N; ++i) {
+        sorgente.push_back(i % 1000);
+    }
+    long long check = 0;
+
+    h.run("window", "int", "WindowAggregator", N, [&] {
+        WindowAggregator<long long, StackSum<long long>> w;
+        for (unsigned int i = 0; i < N; ++i) {
+            w.push(sorgente[i]);
+            if (w.size() > FINESTRA)
+                w.pop();
+            check += w.aggregate();
+        }
+    });
+    h.run("window", "int", "std::queue", N, [&] {
+        std::queue<long long> q;
+        long long somma = 0;
+        for (unsigned int i = 0; i < N; ++i) {
+            q.push(sorgente[i]);
+            somma += sorgente[i];
+            if (q.size() > FINESTRA) {
+                somma -= q.front();
+                q.pop();
+            }
+            check += somma;
+        }
+    });
+
+    bench_keep(check);
+}
+
+int main(int argc, char **argv) {
+    BenchHarness h(argc, argv);
+    casi<int>(h, "int");
+    casi<userCustom>(h, "userCustom");
+    casi_finestra(h);
+    h.report(std::cout);
+    return 0;
+}
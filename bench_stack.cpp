@@ -0,0 +1,224 @@
+#include <iostream>
+#include <deque>
+#include <optional>
+#include <stack>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "stack.h"
+#include "persistent_stack.h"
+#include "custom.h"
+
+/**
+ * @brief Microbenchmark delle operazioni di Stack<T> contro std::vector<T> e std::stack<T>
+ *
+ * Operazioni: push, pop, top, fill, copy, iterate, compare; tipi: int, doubleCustom, userCustom.
+ * Per la copia c'è anche PersistentStack, che condivide i nodi invece di copiarli.
+ * Ogni caso lavora su N elementi e riporta i ns per operazione (per elemento).
+ * std::stack non è iterabile né riempibile da una sequenza: quei casi mancano.
+ *
+ * Uso: bench_stack.exe [--csv | --json] [--reps N] [--warmup N] [--filter testo]
+*/
+
+const unsigned int N = 100000;
+
+// generazione degli elementi e chiave numerica per i checksum
+inline int elemento(int, unsigned int i) {
+    return static_cast<int>(i);
+}
+
+inline doubleCustom elemento(doubleCustom, unsigned int i) {
+    return doubleCustom(i * 0.5);
+}
+
+inline userCustom elemento(userCustom, unsigned int i) {
+    return userCustom("utente", i % 100);
+}
+
+inline long long chiave(int x) {
+    return x;
+}
+
+inline long long chiave(const doubleCustom &x) {
+    return static_cast<long long>(x.getD());
+}
+
+inline long long chiave(const userCustom &x) {
+    return x.getAge();
+}
+
+/**
+ * @brief Registra tutti i casi per il tipo T
+*/
+template <typename T>
+void casi(BenchHarness &h, const std::string &tipo) {
+    std::vector<T> sorgente;
+    for (unsigned int i = 0; i < N; ++i) {
+        sorgente.push_back(elemento(T(), i));
+    }
+
+    // push in un contenitore nuovo (capacità già riservata dove possibile)
+    h.run("push", tipo, "Stack", N, [&] {
+        Stack<T> s(N);
+        for (unsigned int i = 0; i < N; ++i) {
+            s.push(sorgente[i]);
+        }
+        bench_keep(s.size());
+    });
+    h.run("push", tipo, "Stack unchecked", N, [&] {
+        Stack<T> s(N);
+        for (unsigned int i = 0; i < N; ++i) {
+            s.push_unchecked(sorgente[i]);
+        }
+        bench_keep(s.size());
+    });
+    h.run("push", tipo, "Stack CheckNone", N, [&] {
+        Stack<T, std::allocator<T>, NoStackStats, StackCheckNone> s(N);
+        for (unsigned int i = 0; i < N; ++i) {
+            s.push(sorgente[i]);
+        }
+        bench_keep(s.size());
+    });
+    h.run("push", tipo, "vector", N, [&] {
+        std::vector<T> v;
+        v.reserve(N);
+        for (unsigned int i = 0; i < N; ++i) {
+            v.push_back(sorgente[i]);
+        }
+        bench_keep(v.size());
+    });
+    h.run("push", tipo, "std::stack", N, [&] {
+        std::stack<T> s;
+        for (unsigned int i = 0; i < N; ++i) {
+            s.push(sorgente[i]);
+        }
+        bench_keep(s.size());
+    });
+
+    // pop di tutti gli elementi (il riempimento non è misurato)
+    Stack<T> sp(N);
+    std::vector<T> vp;
+    std::stack<T> stdp;
+    long long check = 0;
+    h.run("pop", tipo, "Stack", N, [&] { sp.clear(); sp.push_range(sorgente.begin(), sorgente.end()); }, [&] {
+        while (!sp.empty()) {
+            check += chiave(sp.pop_value());
+        }
+    });
+    h.run("pop", tipo, "Stack unchecked", N, [&] { sp.clear(); sp.push_range(sorgente.begin(), sorgente.end()); }, [&] {
+        while (!sp.empty()) {
+            check += chiave(sp.pop_unchecked());
+        }
+    });
+    h.run("pop", tipo, "Stack try_pop", N, [&] { sp.clear(); sp.push_range(sorgente.begin(), sorgente.end()); }, [&] {
+        while (std::optional<T> x = sp.try_pop()) {
+            check += chiave(*x);
+        }
+    });
+    h.run("pop", tipo, "vector", N, [&] { vp.assign(sorgente.begin(), sorgente.end()); }, [&] {
+        while (!vp.empty()) {
+            check += chiave(vp.back());
+            vp.pop_back();
+        }
+    });
+    h.run("pop", tipo, "std::stack", N, [&] { stdp = std::stack<T>(std::deque<T>(sorgente.begin(), sorgente.end())); }, [&] {
+        while (!stdp.empty()) {
+            check += chiave(stdp.top());
+            stdp.pop();
+        }
+    });
+
+    // top ripetuto su un contenitore pieno (bench_keep impedisce di portare la lettura fuori dal ciclo)
+    Stack<T> s(sorgente.begin(), sorgente.end());
+    std::vector<T> v(sorgente.begin(), sorgente.end());
+    std::stack<T> st(std::deque<T>(sorgente.begin(), sorgente.end()));
+    h.run("top", tipo, "Stack", N, [&] {
+        for (unsigned int i = 0; i < N; ++i) {
+            check += chiave(s.top());
+            bench_keep(check);
+        }
+    });
+    Stack<T, std::allocator<T>, NoStackStats, StackCheckNone> sn(sorgente.begin(), sorgente.end());
+    h.run("top", tipo, "Stack CheckNone", N, [&] {
+        for (unsigned int i = 0; i < N; ++i) {
+            check += chiave(sn.top());
+            bench_keep(check);
+        }
+    });
+    h.run("top", tipo, "vector", N, [&] {
+        for (unsigned int i = 0; i < N; ++i) {
+            check += chiave(v.back());
+            bench_keep(check);
+        }
+    });
+    h.run("top", tipo, "std::stack", N, [&] {
+        for (unsigned int i = 0; i < N; ++i) {
+            check += chiave(st.top());
+            bench_keep(check);
+        }
+    });
+
+    // fill da una sequenza (sovrascrive il contenuto)
+    Stack<T> sf(N);
+    std::vector<T> vf;
+    vf.reserve(N);
+    h.run("fill", tipo, "Stack", N, [&] {
+        sf.fill(sorgente.begin(), sorgente.end());
+        bench_keep(sf.size());
+    });
+    h.run("fill", tipo, "vector", N, [&] {
+        vf.assign(sorgente.begin(), sorgente.end());
+        bench_keep(vf.size());
+    });
+
+    // copia
+    h.run("copy", tipo, "Stack", N, [&] {
+        Stack<T> c(s);
+        bench_keep(c.size());
+    });
+    h.run("copy", tipo, "vector", N, [&] {
+        std::vector<T> c(v);
+        bench_keep(c.size());
+    });
+    h.run("copy", tipo, "std::stack", N, [&] {
+        std::stack<T> c(st);
+        bench_keep(c.size());
+    });
+    PersistentStack<T> ps(sorgente.begin(), sorgente.end());
+    h.run("copy", tipo, "PersistentStack", N, [&] {
+        PersistentStack<T> c(ps);
+        c.push(sorgente[0]);
+        bench_keep(c.size());
+    });
+
+    // iterazione da fondo a cima
+    h.run("iterate", tipo, "Stack", N, [&] {
+        for (const T &x : s) {
+            check += chiave(x);
+        }
+    });
+    h.run("iterate", tipo, "vector", N, [&] {
+        for (const T &x : v) {
+            check += chiave(x);
+        }
+    });
+
+    // confronto tra due contenitori uguali
+    Stack<T> s2(s);
+    std::vector<T> v2(v);
+    std::stack<T> st2(st);
+    h.run("compare", tipo, "Stack", N, [&] { bench_keep(s == s2); });
+    h.run("compare", tipo, "vector", N, [&] { bench_keep(v == v2); });
+    h.run("compare", tipo, "std::stack", N, [&] { bench_keep(st == st2); });
+
+    bench_keep(check);
+}
+
+int main(int argc, char **argv) {
+    BenchHarness h(argc, argv);
+    casi<int>(h, "int");
+    casi<doubleCustom>(h, "doubleCustom");
+    casi<userCustom>(h, "userCustom");
+    h.report(std::cout);
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "work_stealing_stack.h"
+
+/**
+ * @brief Demo di uno scheduler DFS con furto di lavoro e benchmark di scalabilità
+ *
+ * Ogni worker ha il proprio WorkStealingStack di task. Un task è un nodo di un
+ * albero sintetico sbilanciato: il numero di figli dipende da un hash del nodo,
+ * quindi alcuni sottoalberi sono molto più grandi di altri. Un worker esegue i
+ * propri task in ordine LIFO (DFS) e, quando resta senza lavoro, ruba dal fondo
+ * dello stack di un altro worker. Senza furto il lavoro resta dove è nato.
+*/
+
+const std::uint32_t PROFONDITA = 18;
+const int LAVORO_FOGLIA = 200;
+
+/**
+ * @brief Task dello scheduler: un nodo dell'albero sintetico
+*/
+struct Task {
+    std::uint32_t id;
+    std::uint32_t depth;
+};
+
+static std::uint32_t hash(std::uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * @brief Scheduler con un WorkStealingStack per worker
+*/
+class Scheduler {
+
+public:
+    Scheduler(int workers, bool stealing) : stacks_(workers), stealing_(stealing), pending_(0), result_(0) {
+        for (int w = 0; w < workers; ++w) {
+            stacks_[w] = new WorkStealingStack<Task>();
+        }
+    }
+
+    ~Scheduler() {
+        for (WorkStealingStack<Task> *s : stacks_) {
+            delete s;
+        }
+    }
+
+    /**
+     * @brief Distribuisce i task radice tra i worker ed esegue fino ad esaurimento
+     *
+     * @return std::uint64_t somma di controllo calcolata dalle foglie
+    */
+    std::uint64_t run(std::uint32_t roots) {
+        for (std::uint32_t r = 0; r < roots; ++r) {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            stacks_[r % stacks_.size()]->push(Task{hash(r + 1), 0});
+        }
+        std::vector<std::thread> threads;
+        for (std::size_t w = 0; w < stacks_.size(); ++w) {
+            threads.emplace_back([this, w] { work(w); });
+        }
+        for (std::thread &th : threads) {
+            th.join();
+        }
+        return result_.load();
+    }
+
+private:
+    std::vector<WorkStealingStack<Task>*> stacks_;
+    bool stealing_;
+    std::atomic<long long> pending_;
+    std::atomic<std::uint64_t> result_;
+
+    /**
+     * @brief Ciclo del worker w: prima il proprio stack, poi il furto dagli altri
+    */
+    void work(std::size_t w) {
+        WorkStealingStack<Task> &mine = *stacks_[w];
+        std::uint64_t sum = 0;
+        std::uint32_t victim = static_cast<std::uint32_t>(w);
+        while (pending_.load(std::memory_order_acquire) > 0) {
+            std::optional<Task> task = mine.try_pop();
+            if (!task && stealing_ && stacks_.size() > 1) {
+                victim = hash(victim) % stacks_.size();
+                if (victim != w)
+                    task = stacks_[victim]->try_steal();
+            }
+            if (!task) {
+                if (!stealing_ && mine.empty())
+                    break;
+                std::this_thread::yield();
+                continue;
+            }
+            sum += execute(*task, mine);
+            pending_.fetch_sub(1, std::memory_order_release);
+        }
+        result_.fetch_add(sum);
+    }
+
+    /**
+     * @brief Esegue un task: un nodo interno genera i figli, una foglia fa un po' di calcolo
+    */
+    std::uint64_t execute(const Task &task, WorkStealingStack<Task> &mine) {
+        std::uint32_t h = hash(task.id);
+        std::uint32_t children = task.depth < PROFONDITA ? h % 4 : 0;
+        if (children == 0) {
+            std::uint32_t x = h;
+            for (int i = 0; i < LAVORO_FOGLIA; ++i) {
+                x = hash(x);
+            }
+            return x & 0xff;
+        }
+        for (std::uint32_t c = 0; c < children; ++c) {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            mine.push(Task{h + c, task.depth + 1});
+        }
+        return 0;
+    }
+};
+
+int main() {
+    const std::uint32_t RADICI = 64;
+    int massimo = static_cast<int>(std::thread::hardware_concurrency());
+    if (massimo < 8)
+        massimo = 8;
+
+    std::cout << "worker,con furto ms,senza furto ms,check" << std::endl;
+    for (int workers = 1; workers <= massimo; workers *= 2) {
+        auto inizio = std::chrono::steady_clock::now();
+        std::uint64_t check = Scheduler(workers, true).run(RADICI);
+        auto meta = std::chrono::steady_clock::now();
+        std::uint64_t check2 = Scheduler(workers, false).run(RADICI);
+        auto fine = std::chrono::steady_clock::now();
+        std::cout << workers << ","
+                  << std::chrono::duration<double, std::milli>(meta - inizio).count() << ","
+                  << std::chrono::duration<double, std::milli>(fine - meta).count() << ","
+                  << (check == check2 ? "ok" : "ERRORE") << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,412 @@
+#include <iostream>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <stack>
+#include <string>
+#include <vector>
+#include "bench.h"
+#include "stack.h"
+#include "small_stack.h"
+#include "segmented_stack.h"
+
+/**
+ * @brief Benchmark di carichi realistici: gli algoritmi in cui usiamo davvero gli stack
+ *
+ * - expr: valutazione di espressioni con shunting-yard (stack di operatori + stack di operandi)
+ * - dfs: visita in profondità iterativa di un grafo sintetico di un milione di nodi
+ * - brackets: controllo del bilanciamento delle parentesi su un testo generato di 32 MB
+ * - undo: riproduzione di una sessione di modifiche con stack di undo/redo
+ *
+ * Ogni carico è un template sulla configurazione di stack, quindi le configurazioni si
+ * confrontano sullo stesso lavoro. Per ogni coppia viene stampato il throughput e il picco
+ * di memoria allocata dagli stack (misurato con un allocatore che conta i byte vivi).
+ *
+ * Uso: bench_workloads.exe [filtro] (es. "dfs" o "Segmented")
+*/
+
+// ---------------------- MEMORIA ----------------------
+
+static std::size_t byte_vivi = 0;
+static std::size_t byte_picco = 0;
+
+/**
+ * @brief Allocatore che misura il picco di byte allocati dagli stack
+*/
+template <typename T>
+struct PeakAllocator {
+    typedef T value_type;
+
+    PeakAllocator() {}
+
+    template <typename U>
+    PeakAllocator(const PeakAllocator<U> &) {}
+
+    T *allocate(std::size_t n) {
+        byte_vivi += n * sizeof(T);
+        if (byte_vivi > byte_picco)
+            byte_picco = byte_vivi;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) {
+        byte_vivi -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const PeakAllocator &) const { return true; }
+    bool operator!=(const PeakAllocator &) const { return false; }
+};
+
+// ---------------------- CONFIGURAZIONI ----------------------
+
+/**
+ * @brief Adattatore di std::stack (su std::vector) all'interfaccia degli stack del progetto
+*/
+template <typename T>
+class StdStack : public std::stack<T, std::vector<T, PeakAllocator<T>>> {
+
+public:
+    T pop_value() {
+        T value(std::move(this->c.back()));
+        this->c.pop_back();
+        return value;
+    }
+
+    void clear() {
+        this->c.clear();
+    }
+};
+
+struct ConfStackGeometric {
+    static const char *name() { return "Stack Geometric"; }
+    template <typename T> using type = Stack<T, PeakAllocator<T>>;
+    template <typename T> static type<T> make() { return type<T>(16, StackGrowth::Geometric); }
+};
+
+struct ConfStackFixed {
+    static const char *name() { return "Stack Fixed 4M"; }
+    template <typename T> using type = Stack<T, PeakAllocator<T>>;
+    template <typename T> static type<T> make() { return type<T>(1u << 22); }
+};
+
+struct ConfSmallStack {
+    static const char *name() { return "SmallStack<64>"; }
+    template <typename T> using type = SmallStack<T, 64, PeakAllocator<T>>;
+    template <typename T> static type<T> make() { return type<T>(); }
+};
+
+struct ConfSegmentedStack {
+    static const char *name() { return "SegmentedStack<1024>"; }
+    template <typename T> using type = SegmentedStack<T, 1024, PeakAllocator<T>>;
+    template <typename T> static type<T> make() { return type<T>(); }
+};
+
+struct ConfStdStack {
+    static const char *name() { return "std::stack<vector>"; }
+    template <typename T> using type = StdStack<T>;
+    template <typename T> static type<T> make() { return type<T>(); }
+};
+
+// ---------------------- DATI ----------------------
+
+static std::uint64_t stato_rng = 0x9E3779B97F4A7C15ULL;
+
+static std::uint64_t casuale() {
+    stato_rng ^= stato_rng << 13;
+    stato_rng ^= stato_rng >> 7;
+    stato_rng ^= stato_rng << 17;
+    return stato_rng;
+}
+
+/**
+ * @brief Genera un'espressione casuale con + - * e parentesi annidate
+*/
+static void genera_espressione(std::string &out, int profondita) {
+    int termini = 2 + casuale() % 4;
+    for (int t = 0; t < termini; ++t) {
+        if (t > 0)
+            out += "+-*"[casuale() % 3];
+        if (profondita > 0 && casuale() % 3 == 0) {
+            out += '(';
+            genera_espressione(out, profondita - 1);
+            out += ')';
+        }
+        else {
+            out += std::to_string(casuale() % 1000);
+        }
+    }
+}
+
+struct Grafo {
+    std::vector<std::uint32_t> inizio;     // CSR: archi di v in [inizio[v], inizio[v + 1])
+    std::vector<std::uint32_t> archi;
+};
+
+/**
+ * @brief Grafo casuale con n nodi e grado medio 4 (più un cammino che lo rende connesso)
+*/
+static Grafo genera_grafo(std::uint32_t n) {
+    Grafo g;
+    g.inizio.resize(n + 1);
+    for (std::uint32_t v = 0; v < n; ++v) {
+        g.inizio[v] = static_cast<std::uint32_t>(g.archi.size());
+        if (v + 1 < n)
+            g.archi.push_back(v + 1);
+        int grado = casuale() % 7;
+        for (int k = 0; k < grado; ++k) {
+            g.archi.push_back(static_cast<std::uint32_t>(casuale() % n));
+        }
+    }
+    g.inizio[n] = static_cast<std::uint32_t>(g.archi.size());
+    return g;
+}
+
+/**
+ * @brief Testo con parentesi annidate (profondità fino a 4000), rumore e qualche errore
+*/
+static std::string genera_parentesi(std::size_t dimensione) {
+    const char *aperte = "([{<";
+    const char *chiuse = ")]}>";
+    std::string testo;
+    testo.reserve(dimensione);
+    std::string aperti;
+    while (testo.size() < dimensione) {
+        std::uint64_t r = casuale();
+        if (r % 4 == 0) {
+            testo += "abc xyz;\n"[r % 9];
+        }
+        else if (aperti.empty() || ((r >> 2) % 2 == 0 && aperti.size() < 4000)) {
+            int k = (r >> 8) % 4;
+            aperti += chiuse[k];
+            testo += aperte[k];
+        }
+        else {
+            testo += aperti.back();
+            aperti.pop_back();
+        }
+    }
+    // una parentesi sbagliata ogni tanto, poi chiusura di quelle rimaste aperte
+    for (std::size_t i = casuale() % 100000; i < testo.size(); i += 100000) {
+        if (testo[i] == ')')
+            testo[i] = ']';
+    }
+    testo.append(aperti.rbegin(), aperti.rend());
+    return testo;
+}
+
+struct Modifica {
+    std::uint32_t pos;
+    std::int32_t prima;
+    std::int32_t dopo;
+};
+
+// ---------------------- CARICHI ----------------------
+
+/**
+ * @brief Valuta tutte le espressioni del corpus (una per riga) e ritorna la somma dei risultati
+*/
+template <typename C>
+std::uint64_t carico_expr(const std::string &corpus, std::uint64_t &token) {
+    auto operandi = C::template make<std::uint64_t>();
+    auto operatori = C::template make<char>();
+    std::uint64_t somma = 0;
+
+    auto priorita = [](char op) { return op == '*' ? 2 : (op == '(' ? 0 : 1); };
+    auto applica = [&] {
+        char op = operatori.pop_value();
+        std::uint64_t b = operandi.pop_value();
+        std::uint64_t a = operandi.pop_value();
+        operandi.push(op == '+' ? a + b : (op == '-' ? a - b : a * b));
+    };
+
+    for (std::size_t i = 0; i < corpus.size(); ++i) {
+        char c = corpus[i];
+        if (c >= '0' && c <= '9') {
+            std::uint64_t v = 0;
+            for (; i < corpus.size() && corpus[i] >= '0' && corpus[i] <= '9'; ++i) {
+                v = v * 10 + (corpus[i] - '0');
+            }
+            --i;
+            operandi.push(v);
+        }
+        else if (c == '(') {
+            operatori.push(c);
+        }
+        else if (c == ')') {
+            while (operatori.top() != '(') {
+                applica();
+            }
+            operatori.pop_value();
+        }
+        else if (c == '\n') {
+            while (!operatori.empty()) {
+                applica();
+            }
+            somma += operandi.pop_value();
+        }
+        else {
+            while (!operatori.empty() && priorita(operatori.top()) >= priorita(c)) {
+                applica();
+            }
+            operatori.push(c);
+        }
+        ++token;
+    }
+    return somma;
+}
+
+/**
+ * @brief DFS iterativa da ogni nodo non ancora visitato; ritorna la somma dei nodi in ordine di visita
+*/
+template <typename C>
+std::uint64_t carico_dfs(const Grafo &g, std::uint64_t &archi) {
+    std::uint32_t n = static_cast<std::uint32_t>(g.inizio.size() - 1);
+    std::vector<char> visitato(n, 0);
+    auto pila = C::template make<std::uint32_t>();
+    std::uint64_t somma = 0, ordine = 0;
+    for (std::uint32_t radice = 0; radice < n; ++radice) {
+        if (visitato[radice])
+            continue;
+        pila.push(radice);
+        while (!pila.empty()) {
+            std::uint32_t v = pila.pop_value();
+            if (visitato[v])
+                continue;
+            visitato[v] = 1;
+            somma += v * ++ordine;
+            for (std::uint32_t e = g.inizio[v]; e < g.inizio[v + 1]; ++e) {
+                ++archi;
+                if (!visitato[g.archi[e]])
+                    pila.push(g.archi[e]);
+            }
+        }
+    }
+    return somma;
+}
+
+/**
+ * @brief Controlla il bilanciamento del testo; ritorna il numero di errori trovati
+*/
+template <typename C>
+std::uint64_t carico_parentesi(const std::string &testo, std::uint64_t &caratteri) {
+    auto attese = C::template make<char>();
+    std::uint64_t errori = 0;
+    for (char c : testo) {
+        switch (c) {
+        case '(': attese.push(')'); break;
+        case '[': attese.push(']'); break;
+        case '{': attese.push('}'); break;
+        case '<': attese.push('>'); break;
+        case ')': case ']': case '}': case '>':
+            if (attese.empty() || attese.pop_value() != c)
+                ++errori;
+            break;
+        default:
+            break;
+        }
+    }
+    caratteri += testo.size();
+    return errori + attese.size();
+}
+
+/**
+ * @brief Sessione di modifiche con undo/redo su un documento di interi; ritorna il checksum finale
+*/
+template <typename C>
+std::uint64_t carico_undo(const std::vector<std::uint32_t> &azioni, std::uint64_t &operazioni) {
+    std::vector<std::int32_t> documento(1 << 16, 0);
+    auto undo = C::template make<Modifica>();
+    auto redo = C::template make<Modifica>();
+    for (std::uint32_t a : azioni) {
+        std::uint32_t tipo = a % 8;
+        if (tipo < 5) {
+            // nuova modifica: il ramo di redo viene scartato
+            std::uint32_t pos = (a >> 3) & 0xFFFF;
+            Modifica m{pos, documento[pos], static_cast<std::int32_t>(a >> 8)};
+            documento[pos] = m.dopo;
+            undo.push(m);
+            redo.clear();
+        }
+        else if (tipo < 7) {
+            if (!undo.empty()) {
+                Modifica m = undo.pop_value();
+                documento[m.pos] = m.prima;
+                redo.push(m);
+            }
+        }
+        else if (!redo.empty()) {
+            Modifica m = redo.pop_value();
+            documento[m.pos] = m.dopo;
+            undo.push(m);
+        }
+        ++operazioni;
+    }
+    std::uint64_t somma = 0;
+    for (std::int32_t x : documento) {
+        somma = somma * 31 + static_cast<std::uint32_t>(x);
+    }
+    return somma + undo.size();
+}
+
+// ---------------------- ESECUZIONE ----------------------
+
+static const char *filtro = nullptr;
+
+/**
+ * @brief Esegue un carico (tre ripetizioni, vale la migliore) e stampa una riga CSV
+*/
+template <typename F>
+void esegui(const char *carico, const char *stack, const char *unita, F f) {
+    if (filtro != nullptr && std::strstr(carico, filtro) == nullptr && std::strstr(stack, filtro) == nullptr)
+        return;
+    double migliore = 0;
+    std::uint64_t elementi = 0, check = 0;
+    byte_picco = byte_vivi;
+    for (int r = 0; r < 3; ++r) {
+        elementi = 0;
+        auto inizio = std::chrono::steady_clock::now();
+        check = f(elementi);
+        auto fine = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(fine - inizio).count();
+        if (r == 0 || ms < migliore)
+            migliore = ms;
+    }
+    bench_keep(check);
+    std::cout << carico << "," << stack << "," << elementi << "," << unita << "," << migliore << ","
+              << elementi / migliore / 1e3 << "," << byte_picco / 1024.0 << "," << check << std::endl;
+}
+
+template <typename C>
+void esegui_tutti(const std::string &corpus, const Grafo &g, const std::string &testo,
+                  const std::vector<std::uint32_t> &azioni) {
+    esegui("expr", C::name(), "token", [&](std::uint64_t &n) { return carico_expr<C>(corpus, n); });
+    esegui("dfs", C::name(), "archi", [&](std::uint64_t &n) { return carico_dfs<C>(g, n); });
+    esegui("brackets", C::name(), "caratteri", [&](std::uint64_t &n) { return carico_parentesi<C>(testo, n); });
+    esegui("undo", C::name(), "operazioni", [&](std::uint64_t &n) { return carico_undo<C>(azioni, n); });
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1)
+        filtro = argv[1];
+
+    std::string corpus;
+    for (int i = 0; i < 200000; ++i) {
+        genera_espressione(corpus, 6);
+        corpus += '\n';
+    }
+    Grafo g = genera_grafo(1000000);
+    std::string testo = genera_parentesi(32u << 20);
+    std::vector<std::uint32_t> azioni(10000000);
+    for (std::uint32_t &a : azioni) {
+        a = static_cast<std::uint32_t>(casuale());
+    }
+
+    std::cout << "carico,stack,elementi,unita,ms,M elementi/s,picco KB,check" << std::endl;
+    esegui_tutti<ConfStackGeometric>(corpus, g, testo, azioni);
+    esegui_tutti<ConfStackFixed>(corpus, g, testo, azioni);
+    esegui_tutti<ConfSmallStack>(corpus, g, testo, azioni);
+    esegui_tutti<ConfSegmentedStack>(corpus, g, testo, azioni);
+    esegui_tutti<ConfStdStack>(corpus, g, testo, azioni);
+    return 0;
+}
@@ -0,0 +1,277 @@
+#ifndef BLOCKING_STACK_H
+#define BLOCKING_STACK_H
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include "stack.h"
+
+/**
+ * @brief Stack limitato e thread-safe per pipeline produttore/consumatore (più produttori e consumatori)
+ *
+ * Gli elementi stanno in uno Stack Fixed protetto da un mutex: max_size è il limite come per
+ * Stack, ma push() su stack pieno e pop() su stack vuoto attendono invece di lanciare
+ * std::length_error. L'attesa avviene su due condition variable (non pieno / non vuoto),
+ * quindi i thread in attesa dormono invece di riprovare in un ciclo.
+ *
+ * close() sveglia tutti i thread in attesa: da quel momento gli inserimenti falliscono,
+ * i prelievi svuotano gli elementi rimasti e poi restituiscono std::nullopt.
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class BlockingStack {
+
+private:
+    mutable std::mutex m_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    Stack<T, Alloc> s_;
+    bool closed_;
+    unsigned int waiting_push_;     // thread in attesa di posto
+    unsigned int waiting_pop_;      // thread in attesa di elementi
+
+    /**
+     * @brief Metodo privato che attende su cv finché ready() è vero, contando i thread in attesa
+     *
+     * Chi sblocca un'attesa chiama notify solo se il contatore è positivo: senza attese
+     * push e pop non fanno chiamate di sistema.
+    */
+    template <typename Ready>
+    void wait(std::unique_lock<std::mutex>& lock, std::condition_variable& cv, unsigned int& waiting, Ready ready) {
+        while (!ready()) {
+            ++waiting;
+            cv.wait(lock);
+            --waiting;
+        }
+    }
+
+    template <typename Ready, typename Rep, typename Period>
+    bool wait_for(std::unique_lock<std::mutex>& lock, std::condition_variable& cv, unsigned int& waiting,
+                  const std::chrono::duration<Rep, Period>& timeout, Ready ready) {
+        auto scadenza = std::chrono::steady_clock::now() + timeout;
+        while (!ready()) {
+            ++waiting;
+            std::cv_status status = cv.wait_until(lock, scadenza);
+            --waiting;
+            if (status == std::cv_status::timeout)
+                return ready();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Metodo privato che inserisce value (lock preso e posto disponibile) e sveglia un consumatore
+    */
+    template <typename U>
+    void push_locked(std::unique_lock<std::mutex>& lock, U&& value) {
+        s_.push_unchecked(std::forward<U>(value));
+        bool wake = waiting_pop_ > 0;
+        lock.unlock();
+        if (wake)
+            not_empty_.notify_one();
+    }
+
+    /**
+     * @brief Metodo privato che estrae la cima (lock preso e stack non vuoto) e sveglia un produttore
+    */
+    std::optional<T> pop_locked(std::unique_lock<std::mutex>& lock) {
+        std::optional<T> value(s_.pop_unchecked());
+        bool wake = waiting_push_ > 0;
+        lock.unlock();
+        if (wake)
+            not_full_.notify_one();
+        return value;
+    }
+
+    template <typename U>
+    bool push_wait(U&& value) {
+        std::unique_lock<std::mutex> lock(m_);
+        wait(lock, not_full_, waiting_push_, [this] { return closed_ || !s_.full(); });
+        if (closed_)
+            return false;
+        push_locked(lock, std::forward<U>(value));
+        return true;
+    }
+
+    template <typename U>
+    bool push_try(U&& value) {
+        std::unique_lock<std::mutex> lock(m_);
+        if (closed_ || s_.full())
+            return false;
+        push_locked(lock, std::forward<U>(value));
+        return true;
+    }
+
+    template <typename U, typename Rep, typename Period>
+    bool push_for(U&& value, const std::chrono::duration<Rep, Period>& timeout) {
+        std::unique_lock<std::mutex> lock(m_);
+        if (!wait_for(lock, not_full_, waiting_push_, timeout, [this] { return closed_ || !s_.full(); }) || closed_)
+            return false;
+        push_locked(lock, std::forward<U>(value));
+        return true;
+    }
+
+public:
+    typedef T value_type;
+
+    /**
+     * @brief Costruttore con la dimensione massima dello stack
+     *
+     * @param max_size massimo numero di elementi (oltre il quale push() attende)
+     * @param alloc allocatore da cui prendere la memoria dello stack
+     *
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    explicit BlockingStack(unsigned int max_size, const Alloc& alloc = Alloc())
+        : s_(max_size, StackGrowth::Fixed, alloc), closed_(false), waiting_push_(0), waiting_pop_(0) {}
+
+    BlockingStack(const BlockingStack&) = delete;
+    BlockingStack& operator=(const BlockingStack&) = delete;
+
+    /**
+     * @brief Metodo per inserire un elemento, attendendo finché c'è posto
+     *
+     * @param value valore da inserire
+     *
+     * @return false se lo stack è stato chiuso (l'elemento non viene inserito)
+    */
+    bool push(const T& value) {
+        return push_wait(value);
+    }
+
+    bool push(T&& value) {
+        return push_wait(std::move(value));
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento solo se c'è posto subito
+     *
+     * @return false se lo stack è pieno o chiuso
+    */
+    bool try_push(const T& value) {
+        return push_try(value);
+    }
+
+    bool try_push(T&& value) {
+        return push_try(std::move(value));
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento attendendo al massimo timeout
+     *
+     * @return false se allo scadere lo stack è ancora pieno, o se è stato chiuso
+    */
+    template <typename Rep, typename Period>
+    bool try_push_for(const T& value, const std::chrono::duration<Rep, Period>& timeout) {
+        return push_for(value, timeout);
+    }
+
+    template <typename Rep, typename Period>
+    bool try_push_for(T&& value, const std::chrono::duration<Rep, Period>& timeout) {
+        return push_for(std::move(value), timeout);
+    }
+
+    /**
+     * @brief Metodo per estrarre l'elemento in cima, attendendo finché ce n'è uno
+     *
+     * @return std::optional<T> elemento estratto, std::nullopt se lo stack è chiuso e vuoto
+    */
+    std::optional<T> pop() {
+        std::unique_lock<std::mutex> lock(m_);
+        wait(lock, not_empty_, waiting_pop_, [this] { return closed_ || !s_.empty(); });
+        if (s_.empty())
+            return std::nullopt;
+        return pop_locked(lock);
+    }
+
+    /**
+     * @brief Metodo per estrarre l'elemento in cima solo se c'è subito
+     *
+     * @return std::optional<T> elemento estratto, std::nullopt se lo stack è vuoto
+    */
+    std::optional<T> try_pop() {
+        std::unique_lock<std::mutex> lock(m_);
+        if (s_.empty())
+            return std::nullopt;
+        return pop_locked(lock);
+    }
+
+    /**
+     * @brief Metodo per estrarre l'elemento in cima attendendo al massimo timeout
+     *
+     * @return std::optional<T> elemento estratto, std::nullopt se allo scadere lo stack è
+     * ancora vuoto o se è chiuso e vuoto
+    */
+    template <typename Rep, typename Period>
+    std::optional<T> try_pop_for(const std::chrono::duration<Rep, Period>& timeout) {
+        std::unique_lock<std::mutex> lock(m_);
+        if (!wait_for(lock, not_empty_, waiting_pop_, timeout, [this] { return closed_ || !s_.empty(); }) || s_.empty())
+            return std::nullopt;
+        return pop_locked(lock);
+    }
+
+    /**
+     * @brief Metodo per estrarre in blocco tutti gli elementi, attendendo finché ce n'è almeno uno
+     *
+     * Gli elementi vengono scritti in out dal più in basso a quello in cima (come Stack::pop_n)
+     * con il lock preso; poi vengono svegliati tutti i produttori in attesa.
+     *
+     * @param out iteratore di output
+     *
+     * @return OutIter iteratore di output dopo l'ultimo elemento scritto (invariato se lo
+     * stack è chiuso e vuoto)
+    */
+    template <typename OutIter>
+    OutIter pop_all(OutIter out) {
+        std::unique_lock<std::mutex> lock(m_);
+        wait(lock, not_empty_, waiting_pop_, [this] { return closed_ || !s_.empty(); });
+        if (s_.empty())
+            return out;
+        out = s_.pop_n(s_.size(), out);
+        bool wake = waiting_push_ > 0;
+        lock.unlock();
+        if (wake)
+            not_full_.notify_all();
+        return out;
+    }
+
+    /**
+     * @brief Metodo per chiudere lo stack e svegliare tutti i thread in attesa
+    */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(m_);
+            closed_ = true;
+        }
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+    bool closed() const {
+        std::lock_guard<std::mutex> lock(m_);
+        return closed_;
+    }
+
+    bool empty() const {
+        std::lock_guard<std::mutex> lock(m_);
+        return s_.empty();
+    }
+
+    bool full() const {
+        std::lock_guard<std::mutex> lock(m_);
+        return s_.full();
+    }
+
+    unsigned int size() const {
+        std::lock_guard<std::mutex> lock(m_);
+        return s_.size();
+    }
+
+    unsigned int max_size() const {
+        return s_.max_size();
+    }
+};
+
+#endif
@@ -0,0 +1,255 @@
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Stack lock-free (Treiber) utilizzabile da più thread contemporaneamente
+ *
+ * I nodi vivono in un pool di blocchi che non vengono mai restituiti al sistema
+ * prima della distruzione dello stack: un nodo estratto viene riciclato tramite
+ * una free list interna. Un thread che legge il campo next di un nodo appena
+ * estratto da un altro thread legge quindi sempre memoria valida (reclamation
+ * sicura senza hazard pointer).
+ *
+ * La cima dello stack e la free list sono parole da 64 bit composte da indice
+ * del nodo (32 bit bassi) e tag (32 bit alti). Il tag viene incrementato ad ogni
+ * modifica, quindi una compare_exchange su una cima nel frattempo estratta e
+ * reinserita (problema ABA) fallisce.
+*/
+template <typename T>
+class ConcurrentStack {
+
+private:
+
+    struct Node {
+        std::atomic<std::uint32_t> next;
+        alignas(T) unsigned char value[sizeof(T)];
+
+        T* get() {
+            return std::launder(reinterpret_cast<T*>(value));
+        }
+    };
+
+    // il blocco k contiene FIRST_CHUNK << k nodi, gli indici partono da 1 (0 = nessun nodo)
+    static const unsigned int FIRST_CHUNK_BITS = 6;
+    static const std::uint64_t FIRST_CHUNK = std::uint64_t(1) << FIRST_CHUNK_BITS;
+    static const unsigned int MAX_CHUNKS = 32 - FIRST_CHUNK_BITS + 1;
+    static const std::uint32_t MAX_INDEX = UINT32_MAX;
+
+    static_assert(std::uint64_t(MAX_INDEX) - 1 + FIRST_CHUNK < (FIRST_CHUNK << MAX_CHUNKS),
+                  "ConcurrentStack: l'ultimo indice deve cadere in chunks_");
+
+    alignas(64) std::atomic<std::uint64_t> head_;
+    alignas(64) std::atomic<std::uint64_t> free_;
+    alignas(64) std::atomic<std::uint32_t> next_index_;    // 0: indici esauriti (non torna mai a 1)
+    std::atomic<Node*> chunks_[MAX_CHUNKS];
+
+    static std::uint32_t index_of(std::uint64_t word) {
+        return static_cast<std::uint32_t>(word);
+    }
+
+    static std::uint64_t next_word(std::uint64_t old, std::uint32_t index) {
+        return ((old >> 32) + 1) << 32 | index;
+    }
+
+    static unsigned int log2_floor(std::uint64_t x) {
+#if defined(__GNUC__)
+        return 63 - __builtin_clzll(x);
+#else
+        unsigned int r = 0;
+        while (x >>= 1) {
+            ++r;
+        }
+        return r;
+#endif
+    }
+
+    /**
+     * @brief Metodo privato che ritorna il nodo con l'indice specificato
+     *
+     * @param index indice del nodo (> 0)
+    */
+    Node* node(std::uint32_t index) const {
+        std::uint64_t j = std::uint64_t(index) - 1 + FIRST_CHUNK;
+        unsigned int k = log2_floor(j) - FIRST_CHUNK_BITS;
+        return chunks_[k].load(std::memory_order_acquire) + (j - (FIRST_CHUNK << k));
+    }
+
+    /**
+     * @brief Metodo privato che inserisce il nodo index in cima alla lista list
+    */
+    void link(std::atomic<std::uint64_t>& list, std::uint32_t index) {
+        Node* n = node(index);
+        std::uint64_t old = list.load(std::memory_order_relaxed);
+        do {
+            n->next.store(index_of(old), std::memory_order_relaxed);
+        } while (!list.compare_exchange_weak(old, next_word(old, index),
+                                             std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Metodo privato che estrae il nodo in cima alla lista list
+     *
+     * @return std::uint32_t indice del nodo estratto (0 se la lista è vuota)
+    */
+    std::uint32_t unlink(std::atomic<std::uint64_t>& list) {
+        std::uint64_t old = list.load(std::memory_order_acquire);
+        while (index_of(old) != 0) {
+            // il nodo può essere estratto e riciclato da un altro thread nel frattempo:
+            // la lettura resta valida (i nodi non vengono liberati) e il tag fa fallire la CAS
+            std::uint32_t next = node(index_of(old))->next.load(std::memory_order_relaxed);
+            if (list.compare_exchange_weak(old, next_word(old, next),
+                                           std::memory_order_acquire, std::memory_order_acquire))
+                return index_of(old);
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Metodo privato che ottiene un nodo libero (dalla free list o dal pool)
+     *
+     * @throw std::bad_alloc se non è possibile allocare un nuovo blocco di nodi
+     * @throw std::length_error se sono stati esauriti gli indici disponibili
+    */
+    std::uint32_t acquire_node() {
+        std::uint32_t index = unlink(free_);
+        if (index != 0)
+            return index;
+
+        // CAS invece di fetch_add: dopo MAX_INDEX il contatore resta a 0 e non riparte da 1,
+        // quindi nessun thread può ricevere l'indice di un nodo vivo
+        index = next_index_.load(std::memory_order_relaxed);
+        do {
+            if (index == 0)
+                throw std::length_error("ConcurrentStack overflow (indici esauriti)");
+        } while (!next_index_.compare_exchange_weak(index, index == MAX_INDEX ? 0 : index + 1,
+                                                    std::memory_order_relaxed));
+
+        std::uint64_t j = std::uint64_t(index) - 1 + FIRST_CHUNK;
+        unsigned int k = log2_floor(j) - FIRST_CHUNK_BITS;
+        if (chunks_[k].load(std::memory_order_acquire) == nullptr) {
+            Node* chunk = new Node[FIRST_CHUNK << k];
+            Node* expected = nullptr;
+            // un solo thread installa il blocco, gli altri buttano il proprio
+            if (!chunks_[k].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel))
+                delete[] chunk;
+        }
+        return index;
+    }
+
+public:
+
+    /**
+     * @brief Costruttore di default
+    */
+    ConcurrentStack() : head_(0), free_(0), next_index_(1) {
+        for (unsigned int k = 0; k < MAX_CHUNKS; ++k) {
+            chunks_[k].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    /**
+     * @brief Distruttore (non deve essere chiamato mentre altri thread usano lo stack)
+    */
+    ~ConcurrentStack() {
+        std::uint32_t index;
+        while ((index = unlink(head_)) != 0) {
+            node(index)->get()->~T();
+        }
+        for (unsigned int k = 0; k < MAX_CHUNKS; ++k) {
+            delete[] chunks_[k].load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Metodo per costruire un elemento in cima allo stack a partire dagli argomenti
+     *
+     * @param args argomenti passati al costruttore di T
+     *
+     * @throw std::bad_alloc se non è possibile allocare un nuovo blocco di nodi
+    */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        std::uint32_t index = acquire_node();
+        try {
+            ::new (static_cast<void*>(node(index)->value)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            link(free_, index);
+            throw;
+        }
+        link(head_, index);
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima allo stack
+     *
+     * @param value valore da inserire
+    */
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima allo stack spostandolo
+     *
+     * @param value valore da spostare nello stack
+    */
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Metodo per rimuovere l'elemento in cima allo stack, se presente
+     *
+     * @param out riceve l'elemento rimosso
+     *
+     * @return true se un elemento è stato rimosso, false se lo stack era vuoto
+    */
+    bool try_pop(T& out) {
+        std::uint32_t index = unlink(head_);
+        if (index == 0)
+            return false;
+        T* value = node(index)->get();
+        out = std::move(*value);
+        value->~T();
+        link(free_, index);
+        return true;
+    }
+
+    /**
+     * @brief Metodo per rimuovere l'elemento in cima allo stack, se presente
+     *
+     * @return std::optional<T> elemento rimosso (vuoto se lo stack era vuoto)
+    */
+    std::optional<T> try_pop() {
+        std::uint32_t index = unlink(head_);
+        if (index == 0)
+            return std::nullopt;
+        T* value = node(index)->get();
+        std::optional<T> out(std::move(*value));
+        value->~T();
+        link(free_, index);
+        return out;
+    }
+
+    /**
+     * @brief Metodo per verificare se lo stack è vuoto (istantanea, può cambiare subito dopo)
+     *
+     * @return true se lo stack è vuoto
+    */
+    bool empty() const {
+        return index_of(head_.load(std::memory_order_acquire)) == 0;
+    }
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef CUSTOM_H
+#define CUSTOM_H
+
+#include <charconv>
+#include <iostream>
+#include <string>
+#include <utility>
+
+/**
+ * @brief Class customizzata di double per testare le funzioni dello stack
+*/
+class doubleCustom {
+
+public:
+    doubleCustom(double d) : d(d) {}
+    doubleCustom(): d(0) {}
+    doubleCustom(const doubleCustom &other) : d(other.d) {}
+    doubleCustom(doubleCustom &&other) noexcept : d(other.d) {}
+    ~doubleCustom() {}
+
+    operator double() const {
+        return d;
+    }
+    
+    doubleCustom &operator=(const doubleCustom &other) {
+        d = other.d;
+        return *this;
+    }
+
+    doubleCustom &operator=(doubleCustom &&other) noexcept {
+        d = other.d;
+        return *this;
+    }
+
+    bool operator==(const doubleCustom &other) const {
+        return d == other.d;
+    }
+
+    double getD() const {
+        return d;
+    }
+
+    // formattazione veloce per StackFormatter (trovata per ADL)
+    friend void stack_format(std::string& out, const doubleCustom& dc) {
+        char tmp[32];
+        out.append(tmp, std::to_chars(tmp, tmp + sizeof(tmp), dc.d).ptr);
+    }
+
+private:
+    double d;
+};
+
+/**
+ * @brief Class customizzata di User(name, age) per testare le funzioni dello stack
+*/
+class userCustom {
+
+public:
+    userCustom(std::string name, unsigned int age) : name_(std::move(name)), age_(age) {}
+    userCustom(): name_(""), age_(0) {}
+    userCustom(const userCustom &other) : name_(other.name_), age_(other.age_) {}
+    userCustom(userCustom &&other) noexcept : name_(std::move(other.name_)), age_(other.age_) {}
+    ~userCustom() {}
+
+    operator std::string() const {
+        return name_;
+    }
+    
+    userCustom &operator=(const userCustom &other) {
+        name_ = other.name_;
+        age_ = other.age_;
+        return *this;
+    }
+
+    userCustom &operator=(userCustom &&other) noexcept {
+        name_ = std::move(other.name_);
+        age_ = other.age_;
+        return *this;
+    }
+
+    bool operator==(const userCustom &other) const {
+        return name_ == other.name_ && age_ == other.age_;
+    }
+
+    std::string getName() const {
+        return name_;
+    }
+
+    unsigned int getAge() const {
+        return age_;
+    }
+
+    // ridefinizione dell'operatore di output per la classe userCustom
+    friend std::ostream& operator<<(std::ostream& os, const userCustom& uc) {
+        os << "(" << uc.getName() << " " << uc.getAge() << ")";
+        return os;
+    }
+
+    // stessa rappresentazione di operator<<, per StackFormatter (trovata per ADL)
+    friend void stack_format(std::string& out, const userCustom& uc) {
+        char tmp[16];
+        out += '(';
+        out += uc.name_;
+        out += ' ';
+        out.append(tmp, std::to_chars(tmp, tmp + sizeof(tmp), uc.age_).ptr);
+        out += ')';
+    }
+
+private:
+    std::string name_;
+    unsigned int age_;
+};
+
+#endif
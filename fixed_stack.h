@@ -0,0 +1,334 @@
+#ifndef FIXED_STACK_H
+#define FIXED_STACK_H
+
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Stack a capacità fissa N utilizzabile nelle espressioni costanti (constexpr)
+ *
+ * Gli elementi stanno in un array T[N] interno: nessuna allocazione dinamica, nessun
+ * log su std::cerr, quindi per T letterale (int, char, puntatori, struct semplici)
+ * tutta l'API è valutabile a tempo di compilazione e il risultato può finire nel binario
+ * come dato statico. Un overflow o un underflow in un'espressione costante è un errore
+ * di compilazione; a tempo di esecuzione lancia std::length_error come Stack.
+ *
+ * T deve essere default-costruibile e assegnabile per spostamento: le celle libere
+ * contengono T() e push()/emplace() assegnano l'elemento nella cella.
+*/
+template <typename T, unsigned int N>
+class FixedStack {
+
+    static_assert(N > 0, "FixedStack: N deve essere maggiore di 0");
+
+public:
+    typedef T value_type;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::reverse_iterator<const T*> readOnlyIterator;
+
+private:
+    T data_[N];
+    unsigned int top_;
+
+public:
+
+    /**
+     * @brief Costruttore di default (stack vuoto)
+    */
+    constexpr FixedStack() : data_(), top_(0) {}
+
+    /**
+     * @brief Costruttore che inizializza lo stack con i valori specificati
+     *
+     * @param first iteratore all'inizio della sequenza
+     * @param last iteratore alla fine della sequenza
+     *
+     * @throw std::length_error se la sequenza è più lunga di N
+    */
+    template <typename Iter>
+    constexpr FixedStack(Iter first, Iter last) : data_(), top_(0) {
+        push_range(first, last);
+    }
+
+    /**
+     * @brief Costruttore da lista di valori (il primo finisce sul fondo)
+     *
+     * @throw std::length_error se la lista è più lunga di N
+    */
+    constexpr FixedStack(std::initializer_list<T> values) : data_(), top_(0) {
+        push_range(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima allo stack
+     *
+     * @param value valore da inserire
+     *
+     * @throw std::length_error se lo stack è pieno
+    */
+    constexpr void push(const T& value) {
+        if (top_ == N)
+            throw std::length_error("FixedStack overflow in push (top > max_size)");
+        data_[top_++] = value;
+    }
+
+    constexpr void push(T&& value) {
+        if (top_ == N)
+            throw std::length_error("FixedStack overflow in push (top > max_size)");
+        data_[top_++] = std::move(value);
+    }
+
+    /**
+     * @brief Metodo per costruire un elemento in cima allo stack a partire dagli argomenti
+     *
+     * La cella esiste già (contiene T()): il nuovo elemento viene costruito in un temporaneo
+     * e poi assegnato per spostamento, quindi T deve essere move-assignable.
+     *
+     * @return T& riferimento all'elemento inserito
+     *
+     * @throw std::length_error se lo stack è pieno
+    */
+    template <typename... Args>
+    constexpr T& emplace(Args&&... args) {
+        if (top_ == N)
+            throw std::length_error("FixedStack overflow in emplace (top > max_size)");
+        data_[top_] = T(std::forward<Args>(args)...);
+        return data_[top_++];
+    }
+
+    /**
+     * @brief Metodo per rimuovere un elemento in cima allo stack e restituirlo
+     *
+     * @throw std::length_error se lo stack è vuoto
+     *
+     * @return T elemento rimosso
+    */
+    constexpr T pop() {
+        if (top_ == 0)
+            throw std::length_error("FixedStack underflow in pop (top < 0)");
+        --top_;
+        T value(std::move(data_[top_]));
+        data_[top_] = T();
+        return value;
+    }
+
+    constexpr T pop_value() {
+        return pop();
+    }
+
+    /**
+     * @brief Metodo per ottenere l'elemento in cima allo stack
+     *
+     * @throw std::length_error se lo stack è vuoto
+    */
+    constexpr T& top() {
+        if (top_ == 0)
+            throw std::length_error("FixedStack underflow in top (top < 0)");
+        return data_[top_ - 1];
+    }
+
+    constexpr const T& top() const {
+        if (top_ == 0)
+            throw std::length_error("FixedStack underflow in top (top < 0)");
+        return data_[top_ - 1];
+    }
+
+    /**
+     * @brief Metodo per cancellare tutti gli elementi (le celle tornano a T())
+    */
+    constexpr void clear() {
+        for (unsigned int i = 0; i < top_; ++i) {
+            data_[i] = T();
+        }
+        top_ = 0;
+    }
+
+    constexpr bool empty() const {
+        return top_ == 0;
+    }
+
+    constexpr bool full() const {
+        return top_ == N;
+    }
+
+    constexpr unsigned int size() const {
+        return top_;
+    }
+
+    static constexpr unsigned int max_size() {
+        return N;
+    }
+
+    /**
+     * @brief Metodo per riempire lo stack con una nuova sequenza di elementi (sovrascrizione permessa)
+     *
+     * @throw std::length_error se la sequenza è più lunga di N
+    */
+    template <typename Iter>
+    constexpr void fill(Iter first, Iter last) {
+        if (last - first > static_cast<long long>(N))
+            throw std::length_error("Errore fill(): la sequenza di elementi è più lunga di quella dello stack");
+        clear();
+        push_range(first, last);
+    }
+
+    /**
+     * @brief Metodo per inserire in cima una sequenza di elementi (il primo finisce più in basso)
+     *
+     * Tutto o niente, come Stack::push_range: con iteratori forward la lunghezza viene
+     * controllata prima di scrivere; con iteratori di input, se la sequenza non entra,
+     * gli elementi già inseriti vengono tolti prima di lanciare l'eccezione.
+     *
+     * @throw std::length_error se la sequenza non entra nello stack
+    */
+    template <typename Iter>
+    constexpr void push_range(Iter first, Iter last) {
+        typedef typename std::iterator_traits<Iter>::iterator_category category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+            if (static_cast<unsigned long long>(std::distance(first, last)) > N - top_)
+                throw std::length_error("FixedStack overflow in push_range (top > max_size)");
+            for (; first != last; ++first) {
+                data_[top_++] = *first;
+            }
+        }
+        else {
+            unsigned int old_top = top_;
+            for (; first != last; ++first) {
+                if (top_ == N) {
+                    while (top_ > old_top) {
+                        data_[--top_] = T();
+                    }
+                    throw std::length_error("FixedStack overflow in push_range (top > max_size)");
+                }
+                data_[top_++] = *first;
+            }
+        }
+    }
+
+    /**
+     * @brief Metodo che ritorna vero se l'elemento soddisfa il predicato P
+    */
+    template <typename P>
+    constexpr bool checkif(const P& predicate, const T& element) const {
+        return predicate(element);
+    }
+
+    // Interrogazioni su tutto lo stack (gli algoritmi di <algorithm> non sono constexpr in C++17)
+    template <typename P>
+    constexpr unsigned int count_if(P predicate) const {
+        unsigned int n = 0;
+        for (unsigned int i = 0; i < top_; ++i) {
+            if (predicate(data_[i]))
+                ++n;
+        }
+        return n;
+    }
+
+    template <typename P>
+    constexpr bool any_of(P predicate) const {
+        return find_if(predicate) != end();
+    }
+
+    template <typename P>
+    constexpr bool all_of(P predicate) const {
+        for (unsigned int i = 0; i < top_; ++i) {
+            if (!predicate(data_[i]))
+                return false;
+        }
+        return true;
+    }
+
+    template <typename P>
+    constexpr const_iterator find_if(P predicate) const {
+        for (unsigned int i = 0; i < top_; ++i) {
+            if (predicate(data_[i]))
+                return data_ + i;
+        }
+        return end();
+    }
+
+    /**
+     * @brief Operatore di confronto (sul contenuto)
+    */
+    constexpr bool operator==(const FixedStack& other) const {
+        if (top_ != other.top_)
+            return false;
+        for (unsigned int i = 0; i < top_; ++i) {
+            if (!(data_[i] == other.data_[i]))
+                return false;
+        }
+        return true;
+    }
+
+    constexpr bool operator!=(const FixedStack& other) const {
+        return !(*this == other);
+    }
+
+    // Iteratori da fondo a cima e accesso al buffer
+    constexpr iterator begin() {
+        return data_;
+    }
+
+    constexpr iterator end() {
+        return data_ + top_;
+    }
+
+    constexpr const_iterator begin() const {
+        return data_;
+    }
+
+    constexpr const_iterator end() const {
+        return data_ + top_;
+    }
+
+    constexpr const_iterator cbegin() const {
+        return data_;
+    }
+
+    constexpr const_iterator cend() const {
+        return data_ + top_;
+    }
+
+    constexpr T* data() {
+        return data_;
+    }
+
+    constexpr const T* data() const {
+        return data_;
+    }
+
+    /**
+     * @brief Iteratori in sola lettura da cima a fondo
+    */
+    constexpr readOnlyIterator readOnlyBegin() const {
+        return readOnlyIterator(end());
+    }
+
+    constexpr readOnlyIterator readOnlyEnd() const {
+        return readOnlyIterator(begin());
+    }
+
+    /**
+     * @brief Metodo per stampare lo stack (da fondo a cima - sinistra a destra)
+    */
+    friend std::ostream& operator<<(std::ostream& os, const FixedStack& s) {
+        os << "[ ";
+        if (s.empty()) {
+            os << "stack empty ";
+        }
+        else {
+            for (unsigned int i = 0; i < s.top_; i++) {
+                os << s.data_[i] << " ";
+            }
+        }
+        os << "]" << '\n';
+        return os;
+    }
+};
+
+#endif
@@ -1,86 +1,69 @@
 #include <iostream>
 #include <vector>
 #include <cassert>
+#include <thread>
+#include <list>
+#include <sstream>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <unordered_set>
+#include <cstdio>
+#include <optional>
+#include <queue>
+#include <chrono>
 #include "stack.h"
+#include "custom.h"
+#include "small_stack.h"
+#include "concurrent_stack.h"
+#include "work_stealing_stack.h"
+#include "segmented_stack.h"
+#include "mapped_stack.h"
+#include "stack_format.h"
+#include "fixed_stack.h"
+#include "persistent_stack.h"
+#include "aggregating_stack.h"
+#include "stack_queue.h"
+#include "blocking_stack.h"
 
 /**
- * @brief Class customizzata di double per testare le funzioni dello stack
+ * @brief Classe senza costruttore di default che conta le istanze vive per testare lo stack
 */
-class doubleCustom {
+class countedCustom {
 
 public:
-    doubleCustom(double d) : d(d) {}
-    doubleCustom(): d(0) {}
-    doubleCustom(const doubleCustom &other) : d(other.d) {}
-    doubleCustom(doubleCustom &&other) : d(other.d) {}
-    ~doubleCustom() {}
+    explicit countedCustom(int v) : v_(v) { ++alive; }
+    countedCustom(const countedCustom &other) : v_(other.v_) { ++alive; }
+    countedCustom(countedCustom &&other) noexcept : v_(other.v_) { ++alive; }
+    ~countedCustom() { --alive; }
 
-    operator double() const {
-        return d;
-    }
-    
-    doubleCustom &operator=(const doubleCustom &other) {
-        d = other.d;
-        return *this;
-    }
-
-    bool operator==(const doubleCustom &other) const {
-        return d == other.d;
-    }
-
-    double getD() const {
-        return d;
-    }
-
-private:
-    double d;
-};
-
-/**
- * @brief Class customizzata di User(name, age) per testare le funzioni dello stack
-*/
-class userCustom {
-
-public:
-    userCustom(std::string name, unsigned int age) : name_(name), age_(age) {}
-    userCustom(): name_(""), age_(0) {}
-    userCustom(const userCustom &other) : name_(other.name_), age_(other.age_) {}
-    userCustom(userCustom &&other) : name_(other.name_), age_(other.age_) {}
-    ~userCustom() {}
-
-    operator std::string() const {
-        return name_;
-    }
-    
-    userCustom &operator=(const userCustom &other) {
-        name_ = other.name_;
-        age_ = other.age_;
+    countedCustom &operator=(const countedCustom &other) {
+        v_ = other.v_;
         return *this;
     }
 
-    bool operator==(const userCustom &other) const {
-        return name_ == other.name_ && age_ == other.age_;
+    bool operator==(const countedCustom &other) const {
+        return v_ == other.v_;
     }
 
-    std::string getName() const {
-        return name_;
+    bool operator!=(const countedCustom &other) const {
+        return v_ != other.v_;
     }
 
-    unsigned int getAge() const {
-        return age_;
+    int get() const {
+        return v_;
     }
 
-    // ridefinizione dell'operatore di output per la classe userCustom
-    friend std::ostream& operator<<(std::ostream& os, const userCustom& uc) {
-        os << "(" << uc.getName() << " " << uc.getAge() << ")";
-        return os;
-    }
+    static int alive;
 
 private:
-    std::string name_;
-    unsigned int age_;
+    int v_;
 };
 
+int countedCustom::alive = 0;
+
 /**
  * @brief Funzione di test di creazione e assegnamento per lo stack di tipo T
 */
@@ -285,7 +268,7 @@ void testLetturaOnlyStack() {
  * @brief Funtore per il checkif()
 */
 struct biggerThan5 {
-    bool operator()(int i) const {
+    constexpr bool operator()(int i) const {
         return i > 5;
     }
 };
@@ -294,7 +277,7 @@ struct biggerThan5 {
  * @brief Funtore per il checkif()
 */
 struct isOdd {
-    bool operator()(int i) const {
+    constexpr bool operator()(int i) const {
         return i % 2 != 0;
     }
 };
@@ -367,11 +350,1888 @@ void testCheckif() {
     assert(s2.checkif(nameIsPippo(), s2.top()));
 }
 
+/**
+ * @brief Funzione di test dello stack con crescita geometrica (reserve, shrink_to_fit)
+*/
+void testCrescitaDinamica() {
+    std::cout << "----- Crescita dinamica stack tipo T -----" << std::endl;
+
+    // Stack Fixed: il limite resta e push() su stack pieno lancia eccezione
+    Stack<int> s1(2);
+    s1.push(1);
+    s1.push(2);
+    bool thrown = false;
+    try {
+        s1.push(3);
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(s1.max_size() == 2);
+
+    // Stack Geometric: la capacità raddoppia quando lo stack è pieno
+    Stack<int> s2(2, StackGrowth::Geometric);
+    for (int i = 0; i < 1000; ++i) {
+        s2.push(i);
+    }
+    assert(s2.size() == 1000);
+    assert(s2.max_size() >= 1000);
+    assert(s2.top() == 999);
+
+    s2.shrink_to_fit();
+    assert(s2.max_size() == 1000);
+    assert(s2.top() == 999);
+
+    // push di un elemento dello stack stesso durante la riallocazione
+    s2.push(s2.top());
+    assert(s2.size() == 1001);
+    assert(s2.top() == 999);
+
+    Stack<userCustom> s3(0, StackGrowth::Geometric);
+    s3.reserve(2);
+    assert(s3.max_size() == 2);
+    s3.push(userCustom("Mario", 25));
+    s3.push(userCustom("Luigi", 30));
+    s3.push(userCustom("Pippo", 35));
+    assert(s3.size() == 3);
+    assert(s3.top() == userCustom("Pippo", 35));
+
+    std::vector<userCustom> v = {userCustom("Anna", 20), userCustom("Bruno", 21),
+                                 userCustom("Carla", 22), userCustom("Dario", 23)};
+    s3.fill(v.begin(), v.end());
+    assert(s3.size() == 4);
+    assert(s3.top() == userCustom("Dario", 23));
+
+    std::cout << "Stack s3 (userCustom Geometric + fill()): " << s3 << std::endl;
+}
+
+/**
+ * @brief Funzione di test della semantica di spostamento (move, emplace, pop_value)
+*/
+void testSpostamento() {
+    std::cout << "----- Spostamento stack tipo T -----" << std::endl;
+
+    Stack<int> s1(1000000);
+    for (int i = 0; i < 1000000; ++i) {
+        s1.push(i);
+    }
+    const int *top = &s1.top();
+
+    // costruttore di spostamento: il buffer passa da s1 a s2 senza copie
+    Stack<int> s2(std::move(s1));
+    assert(&s2.top() == top);
+    assert(s2.size() == 1000000);
+    assert(s1.empty() && s1.max_size() == 0);
+
+    // assegnamento di spostamento
+    Stack<int> s3;
+    s3 = std::move(s2);
+    assert(&s3.top() == top);
+    assert(s2.empty());
+
+    // assegnamento di copia (copy-and-swap)
+    Stack<int> s4(3);
+    s4 = s3;
+    assert(s4 == s3);
+    assert(&s4.top() != top);
+
+    // auto-assegnamento
+    s4 = s4;
+    assert(s4 == s3);
+
+    Stack<userCustom> s5(3);
+    userCustom mario("Mario", 25);
+    s5.push(std::move(mario));
+    s5.emplace("Luigi", 30);
+    userCustom &pippo = s5.emplace("Pippo", 35);
+    assert(pippo.getName() == "Pippo");
+    assert(s5.full());
+
+    userCustom u = s5.pop_value();
+    assert(u == userCustom("Pippo", 35));
+    assert(s5.size() == 2);
+    assert(s5.top() == userCustom("Luigi", 30));
+
+    Stack<userCustom> s6(std::move(s5));
+    std::swap(s5, s6);
+    assert(s5.size() == 2);
+    assert(s6.empty());
+
+    std::cout << "Stack s5 (userCustom con push(T&&) + emplace()): " << s5 << std::endl;
+}
+
+/**
+ * @brief Funzione di test della memoria non inizializzata (nessun costruttore di default richiesto)
+*/
+void testMemoriaGrezza() {
+    std::cout << "----- Memoria non inizializzata stack tipo T -----" << std::endl;
+
+    {
+        // la capacità non costruisce elementi
+        Stack<countedCustom> s1(1000000);
+        assert(countedCustom::alive == 0);
+
+        for (int i = 0; i < 10; ++i) {
+            s1.emplace(i);
+        }
+        assert(countedCustom::alive == 10);
+
+        // la copia costruisce solo gli elementi vivi
+        Stack<countedCustom> s2(s1);
+        assert(countedCustom::alive == 20);
+        assert(s2 == s1);
+
+        // pop distrugge la cella liberata
+        countedCustom c = s2.pop();
+        assert(c.get() == 9);
+        assert(countedCustom::alive == 20);
+
+        s2.clear();
+        assert(countedCustom::alive == 11);
+
+        // la riallocazione sposta gli elementi senza lasciare istanze in più
+        s1.reserve(2000000);
+        assert(countedCustom::alive == 11);
+        assert(s1.top().get() == 9);
+    }
+    // il distruttore distrugge solo gli elementi vivi
+    assert(countedCustom::alive == 0);
+
+    std::vector<countedCustom> v = {countedCustom(1), countedCustom(2), countedCustom(3)};
+    Stack<countedCustom> s3(v.begin(), v.end());
+    assert(s3.top().get() == 3);
+    assert(countedCustom::alive == 6);
+    s3.fill(v.begin(), v.begin() + 2);
+    assert(s3.top().get() == 2);
+    assert(countedCustom::alive == 5);
+}
+
+/**
+ * @brief Funzione di test dello stack con allocatore (std::pmr)
+*/
+void testAllocatore() {
+    std::cout << "----- Allocatore stack tipo T -----" << std::endl;
+
+    char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    // tutta la memoria dello stack viene dall'arena (null_memory_resource lancia se si esce dal buffer)
+    PmrStack<int> s1(16, StackGrowth::Geometric, &arena);
+    for (int i = 0; i < 100; ++i) {
+        s1.push(i);
+    }
+    assert(s1.top() == 99);
+    assert(s1.get_allocator().resource() == &arena);
+
+    // la copia usa la risorsa di default, la copia con allocatore usa l'arena
+    PmrStack<int> s2(s1);
+    assert(s2.get_allocator().resource() == std::pmr::get_default_resource());
+    PmrStack<int> s3(s1, &arena);
+    assert(s3.get_allocator().resource() == &arena);
+    assert(s3 == s1);
+
+    // l'assegnamento non propaga l'allocatore: s4 resta nell'arena
+    PmrStack<int> s4(&arena);
+    s4 = s2;
+    assert(s4.get_allocator().resource() == &arena);
+    assert(s4 == s2);
+
+    // spostamento tra risorse diverse: elementi spostati, s5 resta sulla sua risorsa
+    PmrStack<int> s5(std::pmr::get_default_resource());
+    s5 = std::move(s4);
+    assert(s5.get_allocator().resource() == std::pmr::get_default_resource());
+    assert(s5.size() == 100);
+
+    std::pmr::unsynchronized_pool_resource pool;
+    PmrStack<userCustom> s6(3, StackGrowth::Fixed, &pool);
+    s6.emplace("Mario", 25);
+    s6.emplace("Luigi", 30);
+    assert(s6.top() == userCustom("Luigi", 30));
+
+    std::cout << "Stack s6 (userCustom su unsynchronized_pool_resource): " << s6 << std::endl;
+}
+
+/**
+ * @brief Allocatore che conta le allocazioni per testare gli stack
+*/
+template <typename T>
+struct countingAllocator {
+    typedef T value_type;
+
+    static int allocations;
+
+    countingAllocator() {}
+
+    template <typename U>
+    countingAllocator(const countingAllocator<U> &) {}
+
+    T *allocate(std::size_t n) {
+        ++allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const countingAllocator &) const { return true; }
+    bool operator!=(const countingAllocator &) const { return false; }
+};
+
+template <typename T>
+int countingAllocator<T>::allocations = 0;
+
+/**
+ * @brief Funzione di test dello stack con buffer interno (SmallStack)
+*/
+void testSmallStack() {
+    std::cout << "----- SmallStack tipo T -----" << std::endl;
+
+    typedef countingAllocator<userCustom> allocUser;
+
+    // fino a N elementi nessuna allocazione
+    SmallStack<userCustom, 4, allocUser> s1;
+    s1.emplace("Mario", 25);
+    s1.emplace("Luigi", 30);
+    s1.push(userCustom("Pippo", 35));
+    s1.push(userCustom("Anna", 20));
+    assert(allocUser::allocations == 0);
+    assert(s1.is_small());
+    assert(s1.top() == userCustom("Anna", 20));
+
+    // oltre N gli elementi passano sull'heap
+    s1.emplace("Bruno", 21);
+    assert(allocUser::allocations == 1);
+    assert(!s1.is_small());
+    assert(s1.size() == 5);
+
+    // copia e spostamento
+    SmallStack<userCustom, 4, allocUser> s2(s1);
+    assert(s2 == s1);
+    SmallStack<userCustom, 4, allocUser> s3(std::move(s2));
+    assert(s3 == s1);
+    assert(allocUser::allocations == 2);    // lo spostamento ruba il buffer, non alloca
+    assert(s2.empty() && s2.is_small());
+
+    // shrink_to_fit riporta gli elementi nel buffer interno
+    s1.pop();
+    s1.pop();
+    s1.shrink_to_fit();
+    assert(s1.is_small());
+    assert(s1.top() == userCustom("Pippo", 35));
+
+    // lettura da fondo a cima e da cima a fondo
+    std::vector<int> v = {1, 2, 3};
+    SmallStack<int, 8> s4(v.begin(), v.end());
+    assert(s4.full());
+    int atteso = 1;
+    for (SmallStack<int, 8>::const_iterator i = s4.begin(); i != s4.end(); ++i) {
+        assert(*i == atteso++);
+    }
+    for (SmallStack<int, 8>::readOnlyIterator i = s4.readOnlyBegin(); i != s4.readOnlyEnd(); ++i) {
+        assert(*i == --atteso);
+    }
+
+    // Fixed: il limite resta anche se il buffer interno è più grande
+    bool thrown = false;
+    try {
+        s4.push(4);
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::cout << "SmallStack s1 (userCustom, N = 4): " << s1 << std::endl;
+}
+
+/**
+ * @brief Funzione di stress test multi-thread dello stack lock-free (ConcurrentStack)
+*/
+void testConcurrentStack() {
+    std::cout << "----- ConcurrentStack multi-thread -----" << std::endl;
+
+    const int THREADS = 8;
+    const int PER_THREAD = 20000;
+
+    ConcurrentStack<int> s;
+    assert(s.empty());
+
+    // ogni thread inserisce valori distinti ed estrae quello che trova, alternando
+    std::vector<std::vector<int>> estratti(THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&s, &estratti, t] {
+            for (int i = 0; i < PER_THREAD; ++i) {
+                s.push(t * PER_THREAD + i);
+                if (i % 3 != 0) {
+                    int v;
+                    if (s.try_pop(v))
+                        estratti[t].push_back(v);
+                }
+            }
+        });
+    }
+    for (std::thread &th : threads) {
+        th.join();
+    }
+
+    // svuotamento finale: ogni valore deve essere estratto esattamente una volta
+    std::vector<int> visti(THREADS * PER_THREAD, 0);
+    for (const std::vector<int> &e : estratti) {
+        for (int v : e) {
+            ++visti[v];
+        }
+    }
+    while (std::optional<int> v = s.try_pop()) {
+        ++visti[*v];
+    }
+    for (int c : visti) {
+        assert(c == 1);
+    }
+    assert(s.empty());
+
+    // tipo non banale: gli elementi rimasti vengono distrutti dal distruttore
+    {
+        ConcurrentStack<countedCustom> s2;
+        s2.emplace(1);
+        s2.push(countedCustom(2));
+        std::optional<countedCustom> c = s2.try_pop();
+        assert(c && c->get() == 2);
+    }
+    assert(countedCustom::alive == 0);
+}
+
+/**
+ * @brief Funzione di test dello stack con furto di lavoro (WorkStealingStack)
+*/
+void testWorkStealingStack() {
+    std::cout << "----- WorkStealingStack -----" << std::endl;
+
+    // proprietario LIFO dalla cima, ladro FIFO dal fondo, crescita oltre la capacità iniziale
+    WorkStealingStack<int> s1(2);
+    for (int i = 0; i < 10; ++i) {
+        s1.push(i);
+    }
+    assert(s1.size() == 10);
+    assert(*s1.try_pop() == 9);
+    assert(*s1.try_steal() == 0);
+    assert(*s1.try_steal() == 1);
+    assert(*s1.try_pop() == 8);
+    while (s1.try_pop()) {}
+    assert(s1.empty());
+    assert(!s1.try_steal());
+
+    // il proprietario inserisce ed estrae mentre 3 ladri rubano: ogni elemento esce una sola volta
+    const int ELEMENTI = 100000;
+    WorkStealingStack<int> s2;
+    std::vector<int> visti(ELEMENTI, 0);
+    std::vector<std::vector<int>> rubati(3);
+    std::atomic<bool> finito(false);
+
+    std::vector<std::thread> ladri;
+    for (int t = 0; t < 3; ++t) {
+        ladri.emplace_back([&s2, &rubati, &finito, t] {
+            while (!finito.load() || !s2.empty()) {
+                if (std::optional<int> v = s2.try_steal())
+                    rubati[t].push_back(*v);
+            }
+        });
+    }
+    for (int i = 0; i < ELEMENTI; ++i) {
+        s2.push(i);
+        if (i % 2 == 0) {
+            if (std::optional<int> v = s2.try_pop())
+                ++visti[*v];
+        }
+    }
+    finito.store(true);
+    for (std::thread &th : ladri) {
+        th.join();
+    }
+    for (const std::vector<int> &r : rubati) {
+        for (int v : r) {
+            ++visti[v];
+        }
+    }
+    for (int c : visti) {
+        assert(c == 1);
+    }
+}
+
+/**
+ * @brief Funzione di test degli inserimenti e delle rimozioni a blocchi (push_range, pop_n, top_n)
+*/
+void testBlocchi() {
+    std::cout << "----- Inserimenti e rimozioni a blocchi stack tipo T -----" << std::endl;
+
+    // blocco contiguo di interi (memcpy)
+    std::vector<int> v(1000000);
+    for (int i = 0; i < 1000000; ++i) {
+        v[i] = i;
+    }
+    Stack<int> s1(0, StackGrowth::Geometric);
+    s1.push_range(v.begin(), v.end());
+    s1.push_range(v.data(), v.data() + 10);
+    assert(s1.size() == 1000010);
+    assert(s1.top() == 9);
+
+    Stack<int>::const_iterator i = s1.top_n(3);
+    assert(*i == 7);
+
+    std::vector<int> out(10);
+    s1.pop_n(10, out.begin());
+    assert(out[0] == 0 && out[9] == 9);
+    assert(s1.top() == 999999);
+
+    std::vector<int> tutti;
+    s1.pop_n(s1.size(), std::back_inserter(tutti));
+    assert(tutti == v);
+    assert(s1.empty());
+
+    // Fixed: la capacità viene controllata una volta e lo stack resta invariato
+    Stack<int> s2(5);
+    s2.push(1);
+    bool thrown = false;
+    try {
+        s2.push_range(v.begin(), v.begin() + 5);
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(s2.size() == 1);
+
+    // sequenze non contigue e iteratori di input
+    std::list<int> l = {2, 3};
+    s2.push_range(l.begin(), l.end());
+    std::istringstream is("4 5");
+    s2.push_range(std::istream_iterator<int>(is), std::istream_iterator<int>());
+    assert(s2.full());
+    assert(s2.top() == 5);
+
+    // tipo non banale: gli elementi vengono spostati fuori e distrutti
+    std::vector<userCustom> v2 = {userCustom("Mario", 25), userCustom("Luigi", 30), userCustom("Pippo", 35)};
+    Stack<userCustom> s3(3);
+    s3.push_range(v2.begin(), v2.end());
+    std::vector<userCustom> out2;
+    s3.pop_n(2, std::back_inserter(out2));
+    assert(out2[0] == userCustom("Luigi", 30));
+    assert(out2[1] == userCustom("Pippo", 35));
+    assert(s3.size() == 1);
+
+    std::cout << "Stack s2 (push_range da list e istream): " << s2 << std::endl;
+}
+
+/**
+ * @brief Funzione di test degli iteratori random access e inversi
+*/
+void testIteratoriRandomAccess() {
+    std::cout << "----- Iteratori random access stack tipo T -----" << std::endl;
+
+    std::vector<int> v = {35, 5, 25, 15, 30, 10, 20};
+    Stack<int> s1(v.begin(), v.end());
+
+    static_assert(std::is_same<std::iterator_traits<Stack<int>::iterator>::iterator_category,
+                               std::random_access_iterator_tag>::value, "iteratore random access");
+
+    assert(std::distance(s1.begin(), s1.end()) == 7);
+    assert(s1.end() - s1.begin() == 7);
+    assert(s1.begin()[2] == 25);
+    assert(*(s1.end() - 1) == 20);
+    assert(s1.data() == &*s1.begin());
+
+    // algoritmi che richiedono iteratori random access
+    std::sort(s1.begin(), s1.end());
+    assert(std::is_sorted(s1.begin(), s1.end()));
+    assert(s1.top() == 35);
+    Stack<int>::const_iterator i = std::lower_bound(s1.cbegin(), s1.cend(), 22);
+    assert(*i == 25);
+    assert(i - s1.cbegin() == 4);
+
+    // iteratori inversi: da cima a fondo
+    assert(*s1.rbegin() == 35);
+    assert(std::accumulate(s1.rbegin(), s1.rend(), 0) == 140);
+    std::vector<int> inv(s1.crbegin(), s1.crend());
+    assert(inv.front() == 35 && inv.back() == 5);
+
+    // l'iteratore read only su uno stack vuoto non esce dal buffer
+    Stack<int> s2(3);
+    assert(s2.readOnlyBegin() == s2.readOnlyEnd());
+
+    // accesso al membro tramite ->
+    Stack<userCustom> s3(2);
+    s3.emplace("Mario", 25);
+    assert(s3.begin()->getName() == "Mario");
+}
+
+/**
+ * @brief Funzione di test delle interrogazioni su tutto lo stack (count_if, any_of, find_if, ...)
+*/
+void testInterrogazioni() {
+    std::cout << "----- Interrogazioni su tutto lo stack tipo T -----" << std::endl;
+
+    std::vector<userCustom> v = {userCustom("Mario", 20), 
+                                 userCustom("Pippo", 21), 
+                                 userCustom("Luigi", 22),
+                                 userCustom("Anna", 19)};
+    Stack<userCustom> s1(v.begin(), v.end());
+
+    assert(s1.count_if(ageBiggerThan20()) == 2);
+    assert(s1.any_of(nameIsLuigi()));
+    assert(!s1.all_of(ageBiggerThan20()));
+
+    // dal fondo il primo con età > 20 è Pippo, dalla cima è Luigi
+    assert(s1.find_if(ageBiggerThan20())->getName() == "Pippo");
+    assert(s1.rfind_if(ageBiggerThan20())->getName() == "Luigi");
+    assert(s1.find_if(nameIsPippo()) - s1.begin() == 1);
+
+    Stack<userCustom> s2(2);
+    assert(s2.find_if(nameIsLuigi()) == s2.end());
+    assert(s2.rfind_if(nameIsLuigi()) == s2.rend());
+    assert(s2.all_of(nameIsLuigi()));
+
+    // stack grande: sopra parallel_threshold (con STACK_PARALLEL la scansione è parallela)
+    Stack<int> s3(0, StackGrowth::Geometric);
+    for (unsigned int i = 0; i < 4 * Stack<int>::parallel_threshold; ++i) {
+        s3.push(i);
+    }
+    assert(s3.count_if(isOdd()) == 2 * Stack<int>::parallel_threshold);
+    assert(s3.all_of([](int i) { return i >= 0; }));
+    assert(*s3.find_if(biggerThan5()) == 6);
+    assert(*s3.rfind_if(isOdd()) == int(4 * Stack<int>::parallel_threshold - 1));
+
+    // stack partizionato: prima i valori <= 1000, poi gli altri
+    Stack<int>::const_iterator p = s3.partition_point([](int i) { return i <= 1000; });
+    assert(*p == 1001);
+}
+
+/**
+ * @brief Tipo senza padding il cui operator== ignora un campo (i byte non bastano per il confronto)
+*/
+struct chiaveVersionata {
+    int id;
+    int versione;
+
+    bool operator==(const chiaveVersionata &other) const {
+        return id == other.id;
+    }
+};
+
+namespace std {
+    template <>
+    struct hash<chiaveVersionata> {
+        size_t operator()(const chiaveVersionata &k) const {
+            return hash<int>()(k.id);
+        }
+    };
+}
+
+/**
+ * @brief Funzione di test del confronto sul contenuto e dell'hash degli stack
+*/
+void testConfrontoHash() {
+    std::cout << "----- Confronto e hash stack tipo T -----" << std::endl;
+
+    // capacità diverse, stesso contenuto: gli stack sono uguali
+    std::vector<int> v = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+    Stack<int> s1(v.begin(), v.end());
+    Stack<int> s2(100);
+    s2.push_range(v.begin(), v.end());
+    assert(s1 == s2);
+    assert(std::hash<Stack<int>>()(s1) == std::hash<Stack<int>>()(s2));
+
+    s2.pop();
+    assert(s1 != s2);
+    s2.push(99);
+    assert(s1 != s2);
+    assert(std::hash<Stack<int>>()(s1) != std::hash<Stack<int>>()(s2));
+
+    // tipi senza rappresentazione unica: confronto elemento per elemento
+    std::vector<doubleCustom> vd = {doubleCustom(1.5), doubleCustom(2.5)};
+    Stack<doubleCustom> s3(vd.begin(), vd.end());
+    Stack<doubleCustom> s4(10);
+    s4.push_range(vd.begin(), vd.end());
+    assert(s3 == s4);
+
+    // uguaglianza definita dall'utente: niente memcmp anche senza padding
+    chiaveVersionata k[] = {{1, 1}, {2, 1}};
+    chiaveVersionata k2[] = {{1, 2}, {2, 7}};
+    Stack<chiaveVersionata> s7(k, k + 2), s8(k2, k2 + 2);
+    assert(s7 == s8);
+    assert(std::hash<Stack<chiaveVersionata>>()(s7) == std::hash<Stack<chiaveVersionata>>()(s8));
+
+    // stack come chiavi di un unordered_set
+    std::unordered_set<Stack<int>> visti;
+    visti.insert(s1);
+    visti.insert(s2);
+    visti.insert(Stack<int>(v.begin(), v.end()));
+    assert(visti.size() == 2);
+    assert(visti.count(s1) == 1);
+
+    Stack<std::string> s5(2);
+    s5.push("progetto");
+    s5.push("c++");
+    Stack<std::string> s6(s5);
+    std::unordered_set<Stack<std::string>> stringhe = {s5, s6};
+    assert(stringhe.size() == 1);
+
+    // due stack vuoti con capacità diverse sono uguali
+    Stack<int> vuoto1, vuoto2(5);
+    assert(vuoto1 == vuoto2);
+    assert(std::hash<Stack<int>>()(vuoto1) == std::hash<Stack<int>>()(vuoto2));
+}
+
+/**
+ * @brief Funzione di test dello stack a segmenti (SegmentedStack)
+*/
+void testSegmentedStack() {
+    std::cout << "----- SegmentedStack tipo T -----" << std::endl;
+
+    SegmentedStack<int, 16> s1;
+    assert(s1.chunks() == 0);
+
+    // gli indirizzi restano stabili: gli elementi non vengono mai spostati
+    s1.push(-1);
+    const int *primo = &s1.top();
+    for (int i = 0; i < 100000; ++i) {
+        s1.push(i);
+    }
+    assert(&*s1.begin() == primo);
+    assert(s1.size() == 100001);
+    assert(s1.top() == 99999);
+    assert(s1.begin()[17] == 16);
+    assert(s1.end() - s1.begin() == 100001);
+
+    // un blocco svuotato resta in cache, i successivi vengono liberati
+    SegmentedStack<int, 16> s2;
+    for (int i = 0; i < 17; ++i) {
+        s2.push(i);
+    }
+    assert(s2.chunks() == 2);
+    s2.pop();
+    assert(s2.chunks() == 2);
+    s2.push(16);
+    s2.pop();
+    s2.pop();
+    assert(s2.chunks() == 2);
+    while (!s2.empty()) {
+        s2.pop();
+    }
+    assert(s2.chunks() == 1);
+
+    // limite massimo, copia, confronto e lettura da cima a fondo
+    std::vector<userCustom> v = {userCustom("Mario", 20), userCustom("Pippo", 21), userCustom("Luigi", 22)};
+    SegmentedStack<userCustom, 2> s3(v.begin(), v.end());
+    assert(s3.full());
+    bool thrown = false;
+    try {
+        s3.emplace("Anna", 19);
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    SegmentedStack<userCustom, 2> s4(s3);
+    assert(s4 == s3);
+    assert(s4.readOnlyBegin()->getName() == "Luigi");
+    assert(s4.pop_value() == userCustom("Luigi", 22));
+    assert(s4 != s3);
+    assert(s4.checkif(nameIsPippo(), s4.top()));
+
+    // gli iteratori costanti non si convertono in iteratori mutabili
+    typedef SegmentedStack<int, 4> seg;
+    static_assert(std::is_convertible<seg::iterator, seg::const_iterator>::value, "iterator -> const_iterator");
+    static_assert(!std::is_convertible<seg::const_iterator, seg::iterator>::value, "const_iterator -> iterator");
+
+    // allocatori pmr su risorse diverse: l'assegnazione copia nella risorsa della destinazione
+    std::pmr::monotonic_buffer_resource r1, r2;
+    typedef SegmentedStack<int, 4, std::pmr::polymorphic_allocator<int>> pmrSeg;
+    pmrSeg p1(100, &r1), p2(100, &r2), p3(100, &r1);
+    for (int i = 0; i < 10; ++i) {
+        p1.push(i);
+    }
+    p2 = p1;
+    assert(p2 == p1 && p2.get_allocator().resource() == &r2);
+    p2.push(10);
+    p3 = std::move(p2);
+    assert(p3.size() == 11 && p3.top() == 10 && p3.get_allocator().resource() == &r1);
+    p1.swap(p3);
+    assert(p1.size() == 11 && p3.size() == 10);
+
+    std::cout << "SegmentedStack s3 (userCustom, blocchi da 2): " << s3 << std::endl;
+}
+
+/**
+ * @brief Funzione di test dello stack persistente su file (MappedStack)
+*/
+void testMappedStack() {
+#ifdef MAPPED_STACK_AVAILABLE
+    std::cout << "----- MappedStack su file -----" << std::endl;
+
+    const char *path = "mapped_stack_test.bin";
+    std::remove(path);
+
+    {
+        MappedStack<int> s1(path, 4);
+        assert(s1.empty());
+        for (int i = 0; i < 100000; ++i) {
+            s1.push(i);
+        }
+        assert(s1.capacity() >= 100000);
+        assert(s1.top() == 99999);
+        s1.sync();
+    }
+
+    // riapertura: il top è nell'header, nessun parsing degli elementi
+    {
+        MappedStack<int> s2(path);
+        assert(s2.size() == 100000);
+        assert(s2.top() == 99999);
+        assert(s2.begin()[500] == 500);
+        assert(s2.pop() == 99999);
+        assert(s2.pop() == 99998);
+    }
+    {
+        MappedStack<int> s3(path);
+        assert(s3.size() == 99998);
+        assert(s3.top() == 99997);
+    }
+
+    // un file di un altro tipo viene rifiutato
+    bool thrown = false;
+    try {
+        MappedStack<double> s4(path);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // una capacità enorme nell'header (capacity * sizeof(int) va in overflow) viene rifiutata
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        std::uint64_t capacita = (1ULL << 62) + 1;
+        f.seekp(16);    // magic[8], version, element_size
+        f.write(reinterpret_cast<const char *>(&capacita), sizeof(capacita));
+    }
+    thrown = false;
+    try {
+        MappedStack<int> s5(path);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    std::remove(path);
+#endif
+}
+
+/**
+ * @brief Codec binario di doubleCustom (il valore come double)
+*/
+template <>
+struct StackCodec<doubleCustom> {
+    static void write(std::ostream &os, const doubleCustom &value) {
+        double d = value.getD();
+        os.write(reinterpret_cast<const char *>(&d), sizeof(d));
+    }
+
+    static doubleCustom read(std::istream &is) {
+        double d = 0;
+        is.read(reinterpret_cast<char *>(&d), sizeof(d));
+        return doubleCustom(d);
+    }
+};
+
+/**
+ * @brief Codec binario di userCustom (nome con il codec di std::string, poi età)
+*/
+template <>
+struct StackCodec<userCustom> {
+    static void write(std::ostream &os, const userCustom &value) {
+        StackCodec<std::string>::write(os, value.getName());
+        std::uint32_t age = value.getAge();
+        os.write(reinterpret_cast<const char *>(&age), sizeof(age));
+    }
+
+    static userCustom read(std::istream &is) {
+        std::string name = StackCodec<std::string>::read(is);
+        std::uint32_t age = 0;
+        is.read(reinterpret_cast<char *>(&age), sizeof(age));
+        return userCustom(name, age);
+    }
+};
+
+/**
+ * @brief Funzione di test della serializzazione binaria dello stack
+*/
+void testSerializzazione() {
+    std::cout << "----- Serializzazione binaria stack tipo T -----" << std::endl;
+
+    // T trivially copyable: un solo blocco
+    Stack<int> s1(1000);
+    for (int i = 0; i < 1000; ++i) {
+        s1.push(i * 3);
+    }
+    std::stringstream ss;
+    s1.save(ss);
+    Stack<int> s2;
+    bool thrown = false;
+    try {
+        s2.load(ss);
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    Stack<int> s3(0, StackGrowth::Geometric);
+    ss.seekg(0);
+    s3.load(ss);
+    assert(s3 == s1);
+    assert(s3.growth() == StackGrowth::Geometric);
+
+    std::vector<unsigned char> buffer = s1.serialize();
+    assert(buffer.size() == sizeof(StackBinaryHeader) + 1000 * sizeof(int));
+    Stack<int> s4(2000);
+    s4.push(-1);
+    s4.deserialize(buffer);
+    assert(s4 == s1);
+    assert(s4.max_size() == 2000);
+
+    // buffer corrotto, troncato o di un altro tipo: lo stack non cambia
+    buffer[sizeof(StackBinaryHeader) + 17] ^= 0x40;
+    thrown = false;
+    try {
+        s4.deserialize(buffer);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(s4 == s1);
+
+    thrown = false;
+    try {
+        s4.deserialize(buffer.data(), buffer.size() - 1);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // elementi di dimensione diversa
+    Stack<double> sf(0, StackGrowth::Geometric);
+    thrown = false;
+    try {
+        sf.deserialize(s1.serialize());
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(sf.empty());
+
+    // header ostile: promette miliardi di elementi, lo stream ne contiene zero.
+    // Deve fallire prima di allocare (anche per uno stack Geometric)
+    std::vector<unsigned char> vuoti = Stack<int>().serialize();
+    StackBinaryHeader ostile;
+    std::memcpy(&ostile, vuoti.data(), sizeof(ostile));
+    ostile.count = 1u << 30;
+    ostile.payload_size = ostile.count * sizeof(int);
+    std::string finto(reinterpret_cast<const char *>(&ostile), sizeof(ostile));
+    Stack<int> sg(0, StackGrowth::Geometric);
+    thrown = false;
+    try {
+        std::istringstream is(finto);
+        sg.load(is);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    assert(thrown && sg.max_size() == 0);
+
+    // count non coerente con payload_size
+    ostile.payload_size = 0;
+    std::memcpy(vuoti.data(), &ostile, sizeof(ostile));
+    thrown = false;
+    try {
+        sg.deserialize(vuoti);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    assert(thrown && sg.max_size() == 0);
+
+    // per T codificato la memoria cresce con gli elementi decodificati, non con h.count
+    Stack<userCustom> uno(1);
+    uno.push(userCustom("Mario", 30));
+    std::vector<unsigned char> bu = uno.serialize();
+    std::memcpy(&ostile, bu.data(), sizeof(ostile));
+    ostile.count = 1u << 30;
+    std::memcpy(bu.data(), &ostile, sizeof(ostile));
+    Stack<userCustom> ug(0, StackGrowth::Geometric);
+    thrown = false;
+    try {
+        ug.deserialize(bu);
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    assert(thrown && ug.max_size() == 0);
+
+    // stack vuoto
+    Stack<int> vuoto;
+    Stack<int> s5(4);
+    s5.push(1);
+    s5.deserialize(vuoto.serialize());
+    assert(s5.empty());
+
+    // T non trivially copyable: un elemento alla volta con StackCodec
+    Stack<userCustom> u1(3);
+    u1.push(userCustom("Mario", 30));
+    u1.push(userCustom("", 0));
+    u1.push(userCustom("Giulia", 25));
+    std::stringstream su;
+    u1.save(su);
+    Stack<userCustom> u2(3);
+    u2.load(su);
+    assert(u2 == u1);
+    assert(u2.top().getName() == "Giulia");
+
+    Stack<userCustom> u3(10);
+    u3.deserialize(u1.serialize());
+    assert(u3 == u1);
+
+    std::vector<doubleCustom> vd = {doubleCustom(1.5), doubleCustom(-2.25), doubleCustom(1e300)};
+    Stack<doubleCustom> d1(vd.begin(), vd.end());
+    Stack<doubleCustom> d2(3);
+    d2.deserialize(d1.serialize());
+    assert(d2 == d1);
+
+    Stack<std::string> t1(2);
+    t1.push("progetto");
+    t1.push(std::string("c\0++", 4));
+    Stack<std::string> t2(2);
+    t2.deserialize(t1.serialize());
+    assert(t2 == t1);
+
+    std::cout << "Stack u2 (userCustom ricaricato): " << u2 << std::endl;
+}
+
+/**
+ * @brief Funzione di test del formattatore testuale (StackFormatter)
+*/
+void testFormattatore() {
+    std::cout << "----- Formattatore stack tipo T -----" << std::endl;
+
+    std::vector<int> v = {1, -20, 300};
+    Stack<int> s1(v.begin(), v.end());
+    StackFormatter f;
+    assert(f.format(s1) == "[ 1 -20 300 ]");
+
+    // stesso testo di operator<< (senza il fine riga)
+    std::ostringstream os;
+    os << s1;
+    assert(os.str() == f.format(s1) + "\n");
+
+    f.set_order(StackOrder::TopDown);
+    f.set_separator(", ");
+    f.set_delimiters("{", "}");
+    assert(f.format(s1) == "{300, -20, 1}");
+
+    Stack<int> vuoto;
+    assert(f.format(vuoto) == "{}");
+
+    StackFormatter csv(",", StackOrder::BottomUp, "", "\n");
+    std::vector<double> vd = {0.5, -1.25, 1e100};
+    Stack<double> s2(vd.begin(), vd.end());
+    assert(csv.format(s2) == "0.5,-1.25,1e+100\n");
+
+    // tipi utente: stack_format() trovata per ADL, stessa resa di operator<<
+    Stack<userCustom> s3(2);
+    s3.push(userCustom("Mario", 30));
+    s3.push(userCustom("Giulia", 25));
+    assert(StackFormatter().format(s3) == "[ (Mario 30) (Giulia 25) ]");
+
+    std::vector<doubleCustom> vc = {doubleCustom(1.5), doubleCustom(2)};
+    SmallStack<doubleCustom> s4(vc.begin(), vc.end());
+    assert(f.format(s4) == "{2, 1.5}");
+
+    Stack<std::string> s5(2);
+    s5.push("progetto");
+    s5.push("c++");
+    assert(csv.format(s5) == "progetto,c++\n");
+
+    // i tipi carattere sono scritti come caratteri, come fa operator<<
+    std::vector<unsigned char> vu = {'a', 'b', 'c'};
+    Stack<unsigned char> s6(vu.begin(), vu.end());
+    std::ostringstream os6;
+    os6 << s6;
+    assert(StackFormatter().format(s6) == "[ a b c ]");
+    assert(os6.str() == StackFormatter().format(s6) + "\n");
+    std::vector<signed char> vs = {'x', 'y'};
+    Stack<signed char> s7(vs.begin(), vs.end());
+    assert(csv.format(s7) == "x,y\n");
+
+    // append() accoda più stack nello stesso buffer, write() scrive senza flush
+    csv.clear();
+    csv.append(s1);
+    csv.append(s5);
+    assert(csv.buffer() == "1,-20,300\nprogetto,c++\n");
+
+    std::ostringstream out;
+    csv.write(out, s1);
+    assert(out.str() == "1,-20,300\n");
+}
+
+/**
+ * @brief Funzione di test della strumentazione dello stack (StackStats)
+*/
+void testStrumentazione() {
+    std::cout << "----- Strumentazione stack tipo T -----" << std::endl;
+
+    typedef Stack<int, std::allocator<int>, StackStats> StackContato;
+    StackStatsRegistry::instance().clear();
+    {
+        StackContato s1(2, StackGrowth::Geometric);
+        s1.stats().set_name("parser");
+        for (int i = 0; i < 10; ++i) {
+            s1.push(i);
+        }
+        s1.emplace(10);
+        s1.top();
+        s1.pop();
+        s1.pop_value();
+        int out[3];
+        s1.pop_n(3, out);
+
+        const StackCounters &c = s1.stats().counters();
+        assert(c.pushes == 11);
+        assert(c.pops == 5);
+        assert(c.tops == 1);
+        assert(c.high_water == 11);
+        assert(c.reallocations == 3);       // 2 -> 4 -> 8 -> 16
+        assert(c.bytes_allocated == (2 + 4 + 8 + 16) * sizeof(int));
+        assert(c.overflows == 0 && c.underflows == 0);
+
+        // la copia ha contatori propri ma lo stesso nome
+        StackContato s2(s1);
+        assert(s2.stats().name() == "parser");
+        assert(s2.stats().counters().pushes == 0);
+        assert(s2.stats().counters().high_water == 6);
+
+        StackContato s3(1);
+        s3.push(1);
+        bool thrown = false;
+        try {
+            s3.push(2);
+        } catch (std::length_error &e) {
+            thrown = true;
+        }
+        assert(thrown);
+        s3.pop();
+        for (int i = 0; i < 2; ++i) {
+            try {
+                s3.pop();
+            } catch (std::length_error &e) {
+            }
+        }
+        assert(s3.stats().counters().overflows == 1);
+        assert(s3.stats().counters().underflows == 2);
+
+        std::vector<int> v = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+        s1.push_range(v.begin(), v.end());
+        assert(s1.stats().counters().pushes == 28);
+        assert(s1.stats().counters().high_water == 23);
+    }
+
+    // alla distruzione i contatori con nome finiscono nel registro
+    StackCounters totale = StackStatsRegistry::instance().get("parser");
+    assert(totale.instances == 2);
+    assert(totale.pushes == 28);
+    assert(totale.high_water == 23);
+    assert(StackStatsRegistry::instance().get("altro").instances == 0);
+
+    std::ostringstream os;
+    StackStatsRegistry::instance().dump(os);
+    assert(os.str().find("parser: push=28") == 0);
+    std::cout << os.str();
+}
+
+/**
+ * @brief Utente letterale (userCustom contiene una std::string, che non è constexpr in C++17)
+*/
+struct constexprUser {
+    const char *name;
+    unsigned int age;
+
+    constexpr bool operator==(const constexprUser &other) const {
+        return age == other.age && name[0] == other.name[0];
+    }
+};
+
+/**
+ * @brief Valuta un'espressione RPN di cifre e + - * a tempo di compilazione
+*/
+constexpr int valutaRPN(const char *expr) {
+    FixedStack<int, 32> operandi;
+    for (; *expr != '\0'; ++expr) {
+        char c = *expr;
+        if (c >= '0' && c <= '9') {
+            operandi.push(c - '0');
+        }
+        else if (c == '+' || c == '-' || c == '*') {
+            int b = operandi.pop();
+            int a = operandi.pop();
+            operandi.push(c == '+' ? a + b : (c == '-' ? a - b : a * b));
+        }
+    }
+    return operandi.pop();
+}
+
+/**
+ * @brief Controlla il bilanciamento delle parentesi a tempo di compilazione
+*/
+constexpr bool bilanciato(const char *testo) {
+    FixedStack<char, 64> attese;
+    for (; *testo != '\0'; ++testo) {
+        char c = *testo;
+        if (c == '(')
+            attese.push(')');
+        else if (c == '[')
+            attese.push(']');
+        else if (c == ')' || c == ']') {
+            if (attese.empty() || attese.pop() != c)
+                return false;
+        }
+    }
+    return attese.empty();
+}
+
+// stesse operazioni di testCreazioneAssegnamento
+constexpr FixedStack<int, 5> creaRiempito() {
+    FixedStack<int, 5> s2;
+    int v[] = {5, 10, 15, 20, 25};
+    s2.fill(v, v + 5);
+    return s2;
+}
+
+constexpr bool testCreazioneConstexpr() {
+    FixedStack<int, 5> s1;
+    FixedStack<int, 5> s2 = creaRiempito();
+    FixedStack<int, 5> s3(s2);
+    FixedStack<int, 5> s9;
+    s9 = s2;
+    return s1.empty() && s1.max_size() == 5 && s2.top() == 25 && s2.full() && s3 == s2 && s9 == s2 && s1 != s2;
+}
+
+// stesse operazioni di testSvuotamento
+constexpr bool testSvuotamentoConstexpr() {
+    FixedStack<char, 7> s1{'a', '?', '2', '#', 'B', 'T', 'S'};
+    char a = s1.pop();
+    char b = s1.pop();
+    char c = s1.top();
+    bool ok = a == 'S' && b == 'T' && c == 'B' && s1.size() == 5;
+    s1.clear();
+    return ok && s1.empty();
+}
+
+// stesse operazioni di testCostruttoreIterato e testLetturaOnlyStack
+constexpr int sommaPesata() {
+    int v[] = {9, 8, 7, 6, 5, 4, 3};
+    FixedStack<int, 7> s2(v, v + 7);
+    int somma = 0, peso = 1;
+    for (FixedStack<int, 7>::const_iterator it = s2.begin(); it != s2.end(); ++it) {
+        somma += *it * peso++;
+    }
+    for (FixedStack<int, 7>::readOnlyIterator it = s2.readOnlyBegin(); it != s2.readOnlyEnd(); ++it) {
+        somma += *it * peso++;
+    }
+    return somma;
+}
+
+// stesse operazioni di testCheckif
+constexpr bool testCheckifConstexpr() {
+    FixedStack<int, 8> s1{1, 2, 3, 4, 5, 6, 7, 8};
+    bool ok = s1.checkif(biggerThan5(), s1.top());
+    s1.pop();
+    ok = ok && s1.checkif(isOdd(), s1.top());
+
+    FixedStack<constexprUser, 3> s2{{"Mario", 20}, {"Pippo", 21}, {"Luigi", 22}};
+    ok = ok && s2.checkif([](const constexprUser &u) { return u.age > 20; }, s2.top());
+    s2.pop();
+    return ok && s2.top().name[0] == 'P';
+}
+
+/**
+ * @brief Funzione di test dello stack constexpr (FixedStack): i controlli avvengono a tempo di compilazione
+*/
+void testFixedStack() {
+    std::cout << "----- FixedStack constexpr -----" << std::endl;
+
+    static_assert(testCreazioneConstexpr(), "creazione e assegnamento");
+    static_assert(testSvuotamentoConstexpr(), "svuotamento");
+    static_assert(sommaPesata() == (9 + 16 + 21 + 24 + 25 + 24 + 21) + (3 * 8 + 4 * 9 + 5 * 10 + 6 * 11 + 7 * 12 + 8 * 13 + 9 * 14),
+                  "iteratori da fondo a cima e da cima a fondo");
+    static_assert(testCheckifConstexpr(), "checkif");
+
+    constexpr FixedStack<int, 8> s{1, 2, 3, 4, 5, 6, 7, 8};
+    static_assert(s.count_if(isOdd()) == 4, "count_if");
+    static_assert(s.any_of(biggerThan5()) && !s.all_of(biggerThan5()), "any_of/all_of");
+    static_assert(*s.find_if(biggerThan5()) == 6, "find_if");
+
+    // parser valutati dal compilatore: il risultato è una costante nel binario
+    static_assert(valutaRPN("34+2*") == 14, "RPN");
+    static_assert(valutaRPN("95-3*12+-") == 9, "RPN");
+    static_assert(bilanciato("([()[]])") && !bilanciato("(]") && !bilanciato("(("), "parentesi");
+
+    constexpr int risultato = valutaRPN("78*9+");
+    int tabella[risultato] = {};
+    assert(sizeof(tabella) / sizeof(int) == 65);
+
+    // a tempo di esecuzione si comporta come Stack
+    FixedStack<int, 2> r{1, 2};
+    bool thrown = false;
+    try {
+        r.push(3);
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // push_range è tutto o niente, con iteratori forward e di input
+    FixedStack<int, 4> p{1};
+    int troppi[] = {2, 3, 4, 5};
+    thrown = false;
+    try {
+        p.push_range(troppi, troppi + 4);
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown && p.size() == 1 && p.top() == 1);
+
+    std::istringstream numeri("2 3 4 5");
+    thrown = false;
+    try {
+        p.push_range(std::istream_iterator<int>(numeri), std::istream_iterator<int>());
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown && p.size() == 1 && p.top() == 1 && p.data()[1] == 0);
+    p.push_range(troppi, troppi + 3);
+    assert(p.full() && p.top() == 4);
+    std::cout << "FixedStack r: " << r << std::endl;
+}
+
+/**
+ * @brief Funzione di test delle operazioni senza eccezioni e delle politiche di controllo
+*/
+void testControlli() {
+    std::cout << "----- try_push/try_pop, unchecked e politiche di controllo -----" << std::endl;
+
+    Stack<int> s1(2);
+    assert(s1.try_push(1));
+    int due = 2;
+    assert(s1.try_push(due));
+    assert(!s1.try_push(3));
+    assert(s1.size() == 2 && s1.top() == 2);
+
+    std::optional<int> v = s1.try_pop();
+    assert(v && *v == 2);
+    int out = 0;
+    assert(s1.try_pop(out) && out == 1);
+    assert(!s1.try_pop());
+    assert(!s1.try_pop(out) && out == 1);
+
+    // uno stack Geometric non è mai pieno per try_push
+    Stack<userCustom> s2(1, StackGrowth::Geometric);
+    assert(s2.try_push(userCustom("Mario", 25)));
+    assert(s2.try_push(userCustom("Luigi", 30)));
+    assert(s2.size() == 2);
+    std::optional<userCustom> u = s2.try_pop();
+    assert(u && u->getName() == "Luigi");
+
+    // unchecked: i limiti sono già noti al chiamante
+    Stack<int> s3(100);
+    for (int i = 0; i < 100; ++i) {
+        s3.push_unchecked(i);
+    }
+    assert(s3.full());
+    long long somma = 0;
+    while (!s3.empty()) {
+        somma += s3.pop_unchecked();
+    }
+    assert(somma == 4950);
+
+    // stesso sorgente con politiche diverse: senza controlli nessuna eccezione di underflow
+    Stack<int, std::allocator<int>, NoStackStats, StackCheckNone> s4(3);
+    s4.push(7);
+    s4.push(8);
+    assert(s4.pop() == 8 && s4.top() == 7);
+    assert(s4.pop_value() == 7 && s4.empty());
+
+    Stack<int, std::allocator<int>, NoStackStats, StackCheckAssert> s5(1);
+    s5.push(1);
+    assert(s5.top() == 1 && s5.pop() == 1);
+
+    // le eccezioni di StackCheckThrow passano ancora dai contatori di StackStats
+    Stack<int, std::allocator<int>, StackStats, StackCheckThrow> s6(1);
+    bool thrown = false;
+    try {
+        s6.top();
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+    assert(s6.stats().counters().underflows == 1);
+}
+
+/**
+ * @brief Tipo la cui copia (e il cui spostamento) può lanciare un'eccezione su richiesta
+*/
+struct copiaFallibile {
+    int v;
+    static bool fallisci;
+
+    explicit copiaFallibile(int x) : v(x) {}
+
+    copiaFallibile(const copiaFallibile &other) : v(other.v) {
+        if (fallisci)
+            throw std::runtime_error("copia fallita");
+    }
+};
+
+bool copiaFallibile::fallisci = false;
+
+/**
+ * @brief Funzione di test dello stack persistente con condivisione dei nodi (PersistentStack)
+*/
+void testPersistentStack() {
+    std::cout << "----- PersistentStack (copie O(1) con condivisione) -----" << std::endl;
+
+    int a[] = {1, 2, 3};
+    PersistentStack<int> s1(a, a + 3);
+    assert(s1.size() == 3 && s1.top() == 3);
+
+    // la copia condivide tutto; push e pop sulla copia non toccano l'originale
+    PersistentStack<int> s2(s1);
+    assert(s2.shares_with(s1) && s2 == s1);
+    s2.push(4);
+    assert(s2.top() == 4 && s2.size() == 4);
+    assert(s1.top() == 3 && s1.size() == 3);
+    assert(s2.pop() == 4 && s2.pop() == 3);
+    assert(s2.size() == 2 && s1.size() == 3 && s1.top() == 3);
+    assert(s2 != s1);
+
+    std::stringstream ss;
+    ss << s1;
+    assert(ss.str() == "[ 1 2 3 ]\n");
+
+    int attesi[] = {3, 2, 1};
+    assert(std::equal(s1.readOnlyBegin(), s1.readOnlyEnd(), attesi));
+
+    // se la copia dell'elemento lancia, pop() non modifica lo stack
+    PersistentStack<copiaFallibile> sc;
+    sc.push(copiaFallibile(1));
+    sc.push(copiaFallibile(2));
+    PersistentStack<copiaFallibile> condiviso(sc);
+    copiaFallibile::fallisci = true;
+    bool thrown = false;
+    try {
+        sc.pop();
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    copiaFallibile::fallisci = false;
+    assert(thrown && sc.size() == 2 && sc.top().v == 2 && sc.shares_with(condiviso));
+    assert(sc.pop().v == 2 && sc.size() == 1 && condiviso.size() == 2);
+
+    // lo stesso per un nodo non condiviso
+    sc.push(copiaFallibile(3));
+    copiaFallibile::fallisci = true;
+    thrown = false;
+    try {
+        sc.pop();
+    } catch (std::runtime_error &e) {
+        thrown = true;
+    }
+    copiaFallibile::fallisci = false;
+    assert(thrown && sc.size() == 2 && sc.top().v == 3);
+
+    thrown = false;
+    PersistentStack<int> vuoto;
+    try {
+        vuoto.pop();
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // molti snapshot di uno stack grande: la memoria cresce solo con la divergenza
+    countedCustom::alive = 0;
+    {
+        const int n = 1000000;
+        PersistentStack<countedCustom> grande;
+        for (int i = 0; i < n; ++i) {
+            grande.emplace(i);
+        }
+        assert(countedCustom::alive == n);
+
+        std::vector<PersistentStack<countedCustom>> snapshot;
+        for (int i = 0; i < 1000; ++i) {
+            snapshot.push_back(grande);
+            snapshot.back().emplace(-i);
+        }
+        assert(countedCustom::alive == n + 1000);
+        assert(snapshot[10].top().get() == -10 && snapshot[10].size() == static_cast<unsigned int>(n) + 1);
+
+        // il pop su un nodo condiviso copia, l'originale resta intatto
+        assert(snapshot[0].pop().get() == 0 && snapshot[0].pop().get() == n - 1);
+        assert(grande.top().get() == n - 1 && grande.size() == static_cast<unsigned int>(n));
+        assert(countedCustom::alive == n + 999);
+
+        snapshot.clear();
+        assert(countedCustom::alive == n);
+        // la distruzione di 10^6 nodi è iterativa
+    }
+    assert(countedCustom::alive == 0);
+}
+
+/**
+ * @brief Funzione di test dei punti di salvataggio dello stack (mark/rollback_to)
+*/
+void testSavepoint() {
+    std::cout << "----- mark/rollback_to (backtracking) -----" << std::endl;
+
+    countedCustom::alive = 0;
+    {
+        Stack<countedCustom> s(10);
+        s.emplace(1);
+        s.emplace(2);
+        StackMark esterno = s.mark();
+        s.emplace(3);
+        StackMark interno = s.mark();
+        s.emplace(4);
+        s.emplace(5);
+        assert(countedCustom::alive == 5);
+
+        // il rollback interno distrugge solo ciò che è stato inserito dopo il mark
+        s.rollback_to(interno);
+        assert(s.size() == 3 && s.top().get() == 3 && countedCustom::alive == 3);
+
+        // lo stesso mark si può riusare per un altro ramo
+        s.emplace(6);
+        s.rollback_to(interno);
+        assert(s.size() == 3 && countedCustom::alive == 3);
+
+        s.rollback_to(esterno);
+        assert(s.size() == 2 && s.top().get() == 2 && countedCustom::alive == 2);
+        assert(s.max_size() == 10);
+
+        // il mark interno ora è più alto della cima: non valido
+        bool thrown = false;
+        try {
+            s.rollback_to(interno);
+        } catch (std::length_error &e) {
+            thrown = true;
+        }
+        assert(thrown && s.size() == 2);
+
+        // in debug anche un mark scaduto e poi superato di nuovo viene rifiutato
+        StackMark scaduto = s.mark();
+        s.pop();
+        s.emplace(7);
+        s.emplace(8);
+        thrown = false;
+        try {
+            s.rollback_to(scaduto);
+        } catch (std::length_error &e) {
+            thrown = true;
+        }
+        assert(thrown == STACK_CHECK_MARKS && s.size() == (STACK_CHECK_MARKS ? 3u : 2u));
+
+        // un mark preso più in basso dopo la discesa resta valido, quello sopra no
+        s.clear();
+        s.emplace(1);
+        s.emplace(2);
+        StackMark alto = s.mark();
+        StackMark alto2 = s.mark();
+        assert(alto.stamp == alto2.stamp);
+        s.pop();
+        StackMark basso = s.mark();
+        s.emplace(9);
+        s.rollback_to(basso);
+        s.emplace(10);
+        s.rollback_to(basso);
+        assert(s.size() == 1);
+        s.emplace(11);
+        thrown = false;
+        try {
+            s.rollback_to(alto);
+        } catch (std::length_error &e) {
+            thrown = true;
+        }
+        assert(thrown == STACK_CHECK_MARKS);
+    }
+    assert(countedCustom::alive == 0);
+
+    // ricerca con backtracking: sottoinsiemi di {2, 3, 5, 7, 8} con somma 10
+    int valori[] = {2, 3, 5, 7, 8};
+    Stack<int> scelte(5);
+    int trovati = 0;
+    std::function<void(int, int)> cerca = [&](int i, int somma) {
+        if (somma == 10) {
+            ++trovati;
+            return;
+        }
+        if (i == 5 || somma > 10)
+            return;
+        StackMark m = scelte.mark();
+        scelte.push(valori[i]);
+        cerca(i + 1, somma + valori[i]);
+        scelte.rollback_to(m);
+        cerca(i + 1, somma);
+        assert(scelte.size() == m.size);
+    };
+    cerca(0, 0);
+    assert(trovati == 3 && scelte.empty());
+}
+
+/**
+ * @brief Monoide non commutativo definito dall'utente (concatenazione) per testare l'ordine
+*/
+struct concatena {
+    std::string identity() const {
+        return "";
+    }
+
+    std::string operator()(const std::string &a, const std::string &b) const {
+        return a + b;
+    }
+};
+
+/**
+ * @brief Funzione di test dello stack con aggregato (AggregatingStack) e della finestra scorrevole (WindowAggregator)
+*/
+void testAggregazione() {
+    std::cout << "----- AggregatingStack e WindowAggregator -----" << std::endl;
+
+    AggregatingStack<int, StackMin<int>> smin;
+    AggregatingStack<int, StackMax<int>> smax(3, StackGrowth::Geometric);
+    AggregatingStack<long long, StackSum<long long>> ssum;
+    assert(smin.aggregate() == INT_MAX && ssum.aggregate() == 0);
+
+    int valori[] = {5, 3, 8, 1, 9, 2};
+    for (int v : valori) {
+        smin.push(v);
+        smax.push(v);
+        ssum.push(v);
+    }
+    assert(smin.aggregate() == 1 && smax.aggregate() == 9 && ssum.aggregate() == 28);
+    assert(smax.size() == 6 && smax.max_size() >= 6);
+
+    // dopo ogni pop l'aggregato torna quello precedente senza ricalcoli
+    assert(smin.pop() == 2 && smin.aggregate() == 1);
+    assert(smin.pop() == 9 && smin.pop() == 1 && smin.aggregate() == 3);
+    assert(smax.pop() == 2 && smax.pop() == 9 && smax.aggregate() == 8);
+    StackMark m = ssum.mark();
+    ssum.push(100);
+    ssum.rollback_to(m);
+    assert(ssum.aggregate() == 28 && ssum.top() == 2);
+
+    AggregatingStack<unsigned int, StackGcd<unsigned int>> sgcd;
+    sgcd.push(12);
+    sgcd.push(18);
+    assert(sgcd.aggregate() == 6);
+    sgcd.push(4);
+    assert(sgcd.aggregate() == 2);
+    sgcd.pop();
+    assert(sgcd.aggregate() == 6);
+
+    // Fixed: overflow come Stack
+    AggregatingStack<int, StackSum<int>> fisso(1);
+    fisso.push(1);
+    bool thrown = false;
+    try {
+        fisso.push(2);
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown && fisso.full());
+
+    // ordine di combinazione per un monoide non commutativo
+    AggregatingStack<std::string, concatena> su;
+    AggregatingStack<std::string, concatena, StackOrder::TopDown> giu;
+    for (const char *x : {"a", "b", "c"}) {
+        su.push(x);
+        giu.push(x);
+    }
+    assert(su.aggregate() == "abc" && giu.aggregate() == "cba");
+
+    // finestra scorrevole: massimo e somma delle ultime 5 letture, confrontati con il calcolo diretto
+    WindowAggregator<int, StackMax<int>> wmax;
+    WindowAggregator<long long, StackSum<long long>> wsum;
+    std::vector<int> letture;
+    unsigned int seme = 12345;
+    for (int i = 0; i < 1000; ++i) {
+        seme = seme * 1103515245u + 12345u;
+        int x = static_cast<int>((seme >> 16) % 1000);
+        letture.push_back(x);
+        wmax.push(x);
+        wsum.push(x);
+        if (wmax.size() > 5) {
+            assert(wmax.pop() == letture[letture.size() - 6]);
+            wsum.pop();
+        }
+        std::vector<int>::iterator inizio = letture.end() - wmax.size();
+        assert(wmax.aggregate() == *std::max_element(inizio, letture.end()));
+        assert(wsum.aggregate() == std::accumulate(inizio, letture.end(), 0LL));
+    }
+
+    WindowAggregator<std::string, concatena> wc;
+    wc.push("a");
+    wc.push("b");
+    assert(wc.front() == "a");
+    wc.push("c");
+    assert(wc.aggregate() == "abc");
+    assert(wc.pop() == "a" && wc.aggregate() == "bc");
+    wc.push("d");
+    assert(wc.aggregate() == "bcd" && wc.size() == 3);
+    wc.clear();
+    assert(wc.empty() && wc.aggregate() == "");
+
+    thrown = false;
+    try {
+        wc.pop();
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+}
+
+/**
+ * @brief Funzione di test della coda realizzata con due stack (StackQueue)
+*/
+void testStackQueue() {
+    std::cout << "----- StackQueue (coda con due stack) -----" << std::endl;
+
+    StackQueue<int> q;
+    assert(q.empty());
+    q.push(1);
+    q.push(2);
+    q.push(3);
+    assert(q.front() == 1 && q.back() == 3 && q.size() == 3);
+    assert(q.pop() == 1);
+
+    // travaso avvenuto: i nuovi elementi restano dietro a quelli già in uscita
+    q.push(4);
+    assert(q.front() == 2 && q.back() == 4);
+    assert(q.pop() == 2 && q.pop() == 3 && q.pop() == 4 && q.empty());
+
+    bool thrown = false;
+    try {
+        q.pop();
+    } catch (std::length_error &e) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    // inserimenti e prelievi a blocchi, confrontati con std::queue
+    StackQueue<userCustom> qu(4);
+    std::queue<userCustom> ref;
+    std::vector<userCustom> blocco;
+    for (int i = 0; i < 8; ++i) {
+        blocco.push_back(userCustom("utente", i));
+    }
+    for (int giro = 0; giro < 10; ++giro) {
+        qu.push_range(blocco.begin(), blocco.end());
+        for (const userCustom &u : blocco) {
+            ref.push(u);
+        }
+        std::vector<userCustom> usciti;
+        qu.pop_n(5, std::back_inserter(usciti));
+        for (const userCustom &u : usciti) {
+            assert(u == ref.front());
+            ref.pop();
+        }
+        assert(qu.size() == ref.size() && qu.front() == ref.front() && qu.back() == ref.back());
+    }
+    std::vector<userCustom> resto;
+    qu.pop_n(1000, std::back_inserter(resto));
+    assert(resto.size() == 30 && qu.empty());
+
+    countedCustom::alive = 0;
+    {
+        StackQueue<countedCustom> qc;
+        for (int i = 0; i < 100; ++i) {
+            qc.emplace(i);
+        }
+        assert(qc.pop().get() == 0);
+        qc.emplace(100);
+        assert(countedCustom::alive == 100);
+        qc.clear();
+        assert(countedCustom::alive == 0);
+        qc.emplace(7);
+    }
+    assert(countedCustom::alive == 0);
+
+    // aggregato opzionale: massimo delle ultime 7 letture, con inserimenti e prelievi a blocchi
+    StackQueue<int, std::allocator<int>, StackMax<int>> qmax;
+    assert(qmax.aggregate() == std::numeric_limits<int>::lowest());
+    std::vector<int> letture;
+    unsigned int seme = 54321;
+    for (int giro = 0; giro < 300; ++giro) {
+        unsigned int n = 1 + giro % 4;
+        for (unsigned int i = 0; i < n; ++i) {
+            seme = seme * 1103515245u + 12345u;
+            letture.push_back(static_cast<int>((seme >> 16) % 1000));
+        }
+        if (n == 1)
+            qmax.push(letture.back());
+        else
+            qmax.push_range(letture.end() - n, letture.end());
+        if (qmax.size() > 9) {
+            std::vector<int> usciti;
+            qmax.pop_n(qmax.size() - 7, std::back_inserter(usciti));
+        }
+        while (qmax.size() > 7) {
+            int vecchio = qmax.pop();
+            assert(vecchio == letture[letture.size() - qmax.size() - 1]);
+        }
+        assert(qmax.aggregate() == *std::max_element(letture.end() - qmax.size(), letture.end()));
+    }
+
+    // monoide non commutativo: l'aggregato segue l'ordine di arrivo anche dopo il travaso
+    StackQueue<std::string, std::allocator<std::string>, concatena> qc;
+    qc.push("a");
+    qc.push("b");
+    assert(qc.pop() == "a");
+    qc.push("c");
+    qc.emplace("d");
+    assert(qc.aggregate() == "bcd" && qc.front() == "b");
+    assert(qc.pop() == "b" && qc.aggregate() == "cd");
+    qc.clear();
+    assert(qc.aggregate() == "");
+}
+
+/**
+ * @brief Funzione di test dello stack limitato e bloccante per produttori/consumatori (BlockingStack)
+*/
+void testBlockingStack() {
+    std::cout << "----- BlockingStack produttori/consumatori -----" << std::endl;
+
+    const int PRODUTTORI = 4;
+    const int CONSUMATORI = 4;
+    const int PER_PRODUTTORE = 20000;
+
+    // capacità piccola: produttori e consumatori si attendono a vicenda
+    BlockingStack<int> s(16);
+    assert(s.max_size() == 16 && s.empty());
+
+    std::vector<std::vector<int>> estratti(CONSUMATORI);
+    std::vector<std::thread> threads;
+    for (int c = 0; c < CONSUMATORI; ++c) {
+        threads.emplace_back([&s, &estratti, c] {
+            while (std::optional<int> v = s.pop()) {
+                estratti[c].push_back(*v);
+            }
+        });
+    }
+    std::vector<std::thread> produttori;
+    for (int p = 0; p < PRODUTTORI; ++p) {
+        produttori.emplace_back([&s, p] {
+            for (int i = 0; i < PER_PRODUTTORE; ++i) {
+                bool ok = s.push(p * PER_PRODUTTORE + i);
+                assert(ok);
+                (void)ok;
+            }
+        });
+    }
+    for (std::thread &th : produttori) {
+        th.join();
+    }
+    // la chiusura sveglia i consumatori in attesa dopo che hanno svuotato lo stack
+    s.close();
+    for (std::thread &th : threads) {
+        th.join();
+    }
+
+    std::vector<int> visti(PRODUTTORI * PER_PRODUTTORE, 0);
+    for (const std::vector<int> &e : estratti) {
+        for (int v : e) {
+            ++visti[v];
+        }
+    }
+    for (int c : visti) {
+        assert(c == 1);
+    }
+    assert(s.empty() && s.closed());
+    assert(!s.push(1) && !s.try_push(1) && !s.pop());
+
+    // attese con timeout
+    BlockingStack<std::string> t(2);
+    assert(!t.try_pop_for(std::chrono::milliseconds(5)));
+    assert(t.try_push("a") && t.try_push_for("b", std::chrono::milliseconds(5)));
+    assert(t.full() && !t.try_push("c"));
+    assert(!t.try_push_for("c", std::chrono::milliseconds(5)));
+    std::optional<std::string> x = t.try_pop_for(std::chrono::milliseconds(5));
+    assert(x && *x == "b");
+
+    // un produttore bloccato su stack pieno viene sbloccato da pop_all
+    t.push("c");
+    std::thread bloccato([&t] {
+        bool ok = t.push("d");
+        assert(ok);
+        (void)ok;
+    });
+    std::vector<std::string> tutti;
+    while (tutti.size() < 3) {
+        t.pop_all(std::back_inserter(tutti));
+    }
+    bloccato.join();
+    assert(tutti.size() == 3 && tutti[0] == "a" && tutti[1] == "c" && tutti[2] == "d");
+
+    // close() sveglia un consumatore bloccato su stack vuoto
+    std::thread attesa([&t] {
+        std::optional<std::string> v = t.pop();
+        assert(!v);
+        (void)v;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    t.close();
+    attesa.join();
+
+    countedCustom::alive = 0;
+    {
+        BlockingStack<countedCustom> c(4);
+        c.push(countedCustom(1));
+        c.push(countedCustom(2));
+        std::optional<countedCustom> v = c.try_pop();
+        assert(v && v->get() == 2);
+    }
+    assert(countedCustom::alive == 0);
+}
+
 int main() {
     testCreazioneAssegnamento();
     testSvuotamento();
     testCostruttoreIterato();
     testLetturaOnlyStack();
     testCheckif();
+    testCrescitaDinamica();
+    testSpostamento();
+    testMemoriaGrezza();
+    testAllocatore();
+    testSmallStack();
+    testConcurrentStack();
+    testWorkStealingStack();
+    testBlocchi();
+    testIteratoriRandomAccess();
+    testInterrogazioni();
+    testConfrontoHash();
+    testSegmentedStack();
+    testMappedStack();
+    testSerializzazione();
+    testFormattatore();
+    testStrumentazione();
+    testFixedStack();
+    testControlli();
+    testPersistentStack();
+    testSavepoint();
+    testAggregazione();
+    testStackQueue();
+    testBlockingStack();
     return 0;
 }
\ No newline at end of file
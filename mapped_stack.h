@@ -0,0 +1,300 @@
+#ifndef MAPPED_STACK_H
+#define MAPPED_STACK_H
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define MAPPED_STACK_AVAILABLE 1
+
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Stack persistente su file mappato in memoria (mmap), per T trivially copyable
+ *
+ * Il file contiene un header (magic, versione, dimensione dell'elemento, capacità e top)
+ * seguito dal buffer contiguo degli elementi, con lo stesso layout di Stack. Il top è
+ * scritto direttamente nell'header mappato, quindi riaprire un file esistente costa O(1)
+ * indipendentemente dal numero di elementi: non c'è nessun parsing. Quando lo stack è
+ * pieno il file viene allungato con ftruncate e rimappato (mremap dove disponibile).
+ * Le parti fredde dello stack possono essere scaricate dal sistema operativo.
+ *
+ * sync() forza la scrittura su disco (msync); senza sync() i dati sono comunque nel
+ * page cache e sopravvivono alla terminazione del processo, ma non ad un crash del sistema.
+*/
+template <typename T>
+class MappedStack {
+
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MappedStack: T deve essere trivially copyable");
+
+private:
+
+    /**
+     * @brief Header all'inizio del file (occupa HEADER_SIZE byte)
+    */
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t element_size;
+        std::uint64_t capacity;
+        std::uint64_t top;
+    };
+
+    static const std::uint32_t VERSION = 1;
+    static const std::size_t HEADER_SIZE = (sizeof(Header) + alignof(T) + 63) / 64 * 64;
+
+    int fd_;
+    unsigned char* map_;
+    std::size_t map_size_;
+
+    Header* header() const {
+        return reinterpret_cast<Header*>(map_);
+    }
+
+    T* elements() const {
+        return reinterpret_cast<T*>(map_ + HEADER_SIZE);
+    }
+
+    static std::size_t file_size(std::uint64_t capacity) {
+        return HEADER_SIZE + static_cast<std::size_t>(capacity) * sizeof(T);
+    }
+
+    [[noreturn]] static void fail(const char* what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    void map(std::size_t size) {
+        void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (p == MAP_FAILED)
+            fail("MappedStack: mmap");
+        map_ = static_cast<unsigned char*>(p);
+        map_size_ = size;
+    }
+
+    void close() {
+        if (map_ != nullptr)
+            ::munmap(map_, map_size_);
+        if (fd_ >= 0)
+            ::close(fd_);
+        map_ = nullptr;
+        fd_ = -1;
+    }
+
+    /**
+     * @brief Metodo privato che allunga il file e rimappa il buffer con la nuova capacità
+     *
+     * @throw std::system_error se ftruncate o il rimappaggio falliscono
+    */
+    void reallocate(std::uint64_t capacity) {
+        std::size_t size = file_size(capacity);
+        if (::ftruncate(fd_, static_cast<off_t>(size)) != 0)
+            fail("MappedStack: ftruncate");
+#if defined(MREMAP_MAYMOVE)
+        void* p = ::mremap(map_, map_size_, size, MREMAP_MAYMOVE);
+        if (p == MAP_FAILED)
+            fail("MappedStack: mremap");
+        map_ = static_cast<unsigned char*>(p);
+        map_size_ = size;
+#else
+        ::munmap(map_, map_size_);
+        map_ = nullptr;
+        map(size);
+#endif
+        header()->capacity = capacity;
+    }
+
+public:
+
+    /**
+     * @brief Costruttore che apre il file specificato o lo crea se non esiste
+     *
+     * @param path percorso del file
+     * @param capacity capacità iniziale se il file viene creato
+     *
+     * @throw std::system_error se il file non può essere aperto, creato o mappato
+     * @throw std::runtime_error se il file esiste ma non è uno stack di T
+    */
+    explicit MappedStack(const std::string& path, unsigned int capacity = 1024) : fd_(-1), map_(nullptr), map_size_(0) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd_ < 0)
+            fail("MappedStack: open");
+        try {
+            struct stat st;
+            if (::fstat(fd_, &st) != 0)
+                fail("MappedStack: fstat");
+
+            if (st.st_size == 0) {
+                // file nuovo: scrive l'header
+                if (capacity == 0)
+                    capacity = 1;
+                if (::ftruncate(fd_, static_cast<off_t>(file_size(capacity))) != 0)
+                    fail("MappedStack: ftruncate");
+                map(file_size(capacity));
+                std::memcpy(header()->magic, "STACKMAP", 8);
+                header()->version = VERSION;
+                header()->element_size = sizeof(T);
+                header()->capacity = capacity;
+                header()->top = 0;
+            }
+            else {
+                // file esistente: solo verifica dell'header, nessuna lettura degli elementi
+                if (static_cast<std::size_t>(st.st_size) < HEADER_SIZE)
+                    throw std::runtime_error("MappedStack: file troppo corto per l'header");
+                map(static_cast<std::size_t>(st.st_size));
+                if (std::memcmp(header()->magic, "STACKMAP", 8) != 0 || header()->version != VERSION)
+                    throw std::runtime_error("MappedStack: il file non è uno stack mappato");
+                if (header()->element_size != sizeof(T))
+                    throw std::runtime_error("MappedStack: dimensione dell'elemento diversa");
+                // nessuna moltiplicazione con valori letti dal file: non può andare in overflow
+                if (header()->capacity > (map_size_ - HEADER_SIZE) / sizeof(T) || header()->top > header()->capacity)
+                    throw std::runtime_error("MappedStack: header corrotto");
+            }
+        } catch (...) {
+            close();
+            throw;
+        }
+    }
+
+    MappedStack(const MappedStack&) = delete;
+    MappedStack& operator=(const MappedStack&) = delete;
+
+    /**
+     * @brief Costruttore di spostamento
+     *
+     * @param other stack da spostare (rimane chiuso)
+    */
+    MappedStack(MappedStack&& other) noexcept : fd_(other.fd_), map_(other.map_), map_size_(other.map_size_) {
+        other.fd_ = -1;
+        other.map_ = nullptr;
+        other.map_size_ = 0;
+    }
+
+    /**
+     * @brief Distruttore: smappa e chiude il file (i dati restano nel file)
+    */
+    ~MappedStack() {
+        close();
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima allo stack (il file cresce se serve)
+     *
+     * @param value valore da inserire
+     *
+     * @throw std::system_error se il file non può crescere
+    */
+    void push(const T& value) {
+        std::uint64_t top = header()->top;
+        if (top == header()->capacity)
+            reallocate(top * 2);
+        elements()[top] = value;
+        header()->top = top + 1;
+    }
+
+    /**
+     * @brief Metodo per rimuovere un elemento in cima allo stack e restituirlo
+     *
+     * @throw std::length_error se lo stack è vuoto
+     *
+     * @return T elemento rimosso
+    */
+    T pop() {
+        std::uint64_t top = header()->top;
+        if (top == 0)
+            throw std::length_error("MappedStack underflow in pop (top < 0)");
+        header()->top = top - 1;
+        return elements()[top - 1];
+    }
+
+    /**
+     * @brief Metodo per ottenere l'elemento in cima allo stack
+     *
+     * @throw std::length_error se lo stack è vuoto
+     *
+     * @return T& riferimento all'elemento in cima (nella memoria mappata)
+    */
+    T& top() const {
+        std::uint64_t top = header()->top;
+        if (top == 0)
+            throw std::length_error("MappedStack underflow in top (top < 0)");
+        return elements()[top - 1];
+    }
+
+    void clear() {
+        header()->top = 0;
+    }
+
+    bool empty() const {
+        return header()->top == 0;
+    }
+
+    std::uint64_t size() const {
+        return header()->top;
+    }
+
+    /**
+     * @brief Metodo per ottenere la capacità attuale del file (in elementi)
+    */
+    std::uint64_t capacity() const {
+        return header()->capacity;
+    }
+
+    /**
+     * @brief Metodo per riservare spazio nel file per almeno capacity elementi
+     *
+     * @throw std::system_error se il file non può crescere
+    */
+    void reserve(std::uint64_t capacity) {
+        if (capacity > header()->capacity)
+            reallocate(capacity);
+    }
+
+    /**
+     * @brief Metodo per forzare la scrittura su disco di elementi e header
+     *
+     * @throw std::system_error se msync fallisce
+    */
+    void sync() {
+        if (::msync(map_, map_size_, MS_SYNC) != 0)
+            fail("MappedStack: msync");
+    }
+
+    // Accesso diretto al buffer e iteratori da fondo a cima
+    T* data() {
+        return elements();
+    }
+
+    const T* data() const {
+        return elements();
+    }
+
+    T* begin() {
+        return elements();
+    }
+
+    T* end() {
+        return elements() + header()->top;
+    }
+
+    const T* begin() const {
+        return elements();
+    }
+
+    const T* end() const {
+        return elements() + header()->top;
+    }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,335 @@
+#ifndef PERSISTENT_STACK_H
+#define PERSISTENT_STACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Stack persistente con condivisione strutturale (copy-on-write)
+ *
+ * Gli elementi sono nodi immutabili di una lista concatenata dalla cima verso il fondo,
+ * con un contatore di riferimenti atomico intrusivo. Copiare lo stack costa O(1)
+ * (un incremento del contatore della cima); push e pop su una copia creano o lasciano
+ * solo i propri nodi, quindi l'originale non cambia e i prefissi comuni (il fondo)
+ * sono memorizzati una volta sola. La memoria di molti snapshot è proporzionale
+ * a quanto divergono, non alla loro dimensione.
+ *
+ * top() restituisce un riferimento costante: un nodo può essere condiviso.
+ * Copie diverse possono essere usate da thread diversi; lo stesso oggetto no.
+ * La distruzione di una catena lunga è iterativa (nessuna ricorsione).
+ *
+ * Un nodo condiviso viene liberato dall'allocatore dell'ultima copia che lo rilascia, non
+ * necessariamente da quello che lo ha allocato: Alloc deve quindi essere senza stato
+ * (is_always_equal), come std::allocator.
+*/
+template <typename T, typename Alloc = std::allocator<T>>
+class PersistentStack {
+
+private:
+
+    struct Node {
+        std::atomic<unsigned int> refs;
+        Node* next;     // il nodo possiede un riferimento a next
+        T value;
+
+        template <typename... Args>
+        Node(Node* next, Args&&... args) : refs(1), next(next), value(std::forward<Args>(args)...) {}
+    };
+
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> node_allocator;
+    typedef std::allocator_traits<node_allocator> node_traits;
+
+    static_assert(node_traits::is_always_equal::value,
+                  "PersistentStack: Alloc deve essere senza stato (i nodi condivisi sono liberati da qualunque copia)");
+
+    Node* head_;
+    unsigned int size_;
+    node_allocator alloc_;
+
+    static Node* retain(Node* n) {
+        if (n != nullptr)
+            n->refs.fetch_add(1, std::memory_order_relaxed);
+        return n;
+    }
+
+    void destroy_node(Node* n) {
+        node_traits::destroy(alloc_, n);
+        node_traits::deallocate(alloc_, n, 1);
+    }
+
+    /**
+     * @brief Metodo privato che rilascia un riferimento a n e ai nodi che restano senza proprietari
+    */
+    void release(Node* n) {
+        while (n != nullptr && n->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Node* next = n->next;
+            destroy_node(n);
+            n = next;
+        }
+    }
+
+    template <typename... Args>
+    void push_node(Args&&... args) {
+        Node* n = node_traits::allocate(alloc_, 1);
+        try {
+            // il nuovo nodo prende il riferimento dello stack alla vecchia cima
+            node_traits::construct(alloc_, n, head_, std::forward<Args>(args)...);
+        } catch (...) {
+            node_traits::deallocate(alloc_, n, 1);
+            throw;
+        }
+        head_ = n;
+        ++size_;
+    }
+
+public:
+    typedef T value_type;
+
+    /**
+     * @brief Iteratore in sola lettura dalla cima al fondo
+    */
+    class readOnlyIterator {
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T* pointer;
+        typedef const T& reference;
+
+        readOnlyIterator() : n_(nullptr) {}
+
+        reference operator*() const {
+            return n_->value;
+        }
+
+        pointer operator->() const {
+            return &n_->value;
+        }
+
+        readOnlyIterator& operator++() {
+            n_ = n_->next;
+            return *this;
+        }
+
+        readOnlyIterator operator++(int) {
+            readOnlyIterator tmp(*this);
+            n_ = n_->next;
+            return tmp;
+        }
+
+        bool operator==(const readOnlyIterator& other) const {
+            return n_ == other.n_;
+        }
+
+        bool operator!=(const readOnlyIterator& other) const {
+            return n_ != other.n_;
+        }
+
+    private:
+        const Node* n_;
+
+        explicit readOnlyIterator(const Node* n) : n_(n) {}
+
+        friend class PersistentStack;
+    };
+
+    /**
+     * @brief Costruttore di default (stack vuoto)
+    */
+    explicit PersistentStack(const Alloc& alloc = Alloc()) : head_(nullptr), size_(0), alloc_(alloc) {}
+
+    /**
+     * @brief Costruttore che inserisce i valori specificati (il primo finisce sul fondo)
+     *
+     * @param first iteratore all'inizio della sequenza
+     * @param last iteratore alla fine della sequenza
+    */
+    template <typename Iter>
+    PersistentStack(Iter first, Iter last, const Alloc& alloc = Alloc()) : head_(nullptr), size_(0), alloc_(alloc) {
+        try {
+            for (; first != last; ++first) {
+                push_node(*first);
+            }
+        } catch (...) {
+            release(head_);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Costruttore di copia: O(1), condivide tutti i nodi
+    */
+    PersistentStack(const PersistentStack& other) noexcept
+        : head_(retain(other.head_)), size_(other.size_), alloc_(other.alloc_) {}
+
+    PersistentStack(PersistentStack&& other) noexcept
+        : head_(other.head_), size_(other.size_), alloc_(std::move(other.alloc_)) {
+        other.head_ = nullptr;
+        other.size_ = 0;
+    }
+
+    /**
+     * @brief Operatore di assegnazione: O(1) più il rilascio dei nodi non più usati
+    */
+    PersistentStack& operator=(PersistentStack other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~PersistentStack() {
+        release(head_);
+    }
+
+    void swap(PersistentStack& other) noexcept {
+        std::swap(head_, other.head_);
+        std::swap(size_, other.size_);
+        std::swap(alloc_, other.alloc_);
+    }
+
+    friend void swap(PersistentStack& a, PersistentStack& b) noexcept {
+        a.swap(b);
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima (alloca un solo nodo, le copie non cambiano)
+     *
+     * @param value valore da inserire
+    */
+    void push(const T& value) {
+        push_node(value);
+    }
+
+    void push(T&& value) {
+        push_node(std::move(value));
+    }
+
+    template <typename... Args>
+    const T& emplace(Args&&... args) {
+        push_node(std::forward<Args>(args)...);
+        return head_->value;
+    }
+
+    /**
+     * @brief Metodo per rimuovere l'elemento in cima e restituirlo
+     *
+     * Se il nodo non è condiviso l'elemento viene spostato (se lo spostamento non lancia),
+     * altrimenti copiato. Se la copia lancia lo stack non viene modificato.
+     *
+     * @throw std::length_error se lo stack è vuoto
+     *
+     * @return T elemento rimosso
+    */
+    T pop() {
+        if (head_ == nullptr)
+            throw std::length_error("PersistentStack underflow in pop (top < 0)");
+        // il valore viene estratto prima di toccare lo stack: se T lancia non cambia nulla
+        Node* n = head_;
+        if (n->refs.load(std::memory_order_acquire) == 1) {
+            T value(std::move_if_noexcept(n->value));
+            // unico proprietario: lo stack eredita il riferimento del nodo a next
+            head_ = n->next;
+            --size_;
+            destroy_node(n);
+            return value;
+        }
+        T value(n->value);
+        head_ = retain(n->next);
+        --size_;
+        release(n);
+        return value;
+    }
+
+    T pop_value() {
+        return pop();
+    }
+
+    /**
+     * @brief Metodo per ottenere l'elemento in cima (in sola lettura: il nodo può essere condiviso)
+     *
+     * @throw std::length_error se lo stack è vuoto
+    */
+    const T& top() const {
+        if (head_ == nullptr)
+            throw std::length_error("PersistentStack underflow in top (top < 0)");
+        return head_->value;
+    }
+
+    void clear() {
+        release(head_);
+        head_ = nullptr;
+        size_ = 0;
+    }
+
+    bool empty() const {
+        return head_ == nullptr;
+    }
+
+    unsigned int size() const {
+        return size_;
+    }
+
+    /**
+     * @brief Metodo per sapere se due stack condividono la stessa cima (e quindi tutto il contenuto)
+    */
+    bool shares_with(const PersistentStack& other) const {
+        return head_ == other.head_;
+    }
+
+    /**
+     * @brief Operatore di confronto (sul contenuto); si ferma al primo nodo condiviso
+    */
+    bool operator==(const PersistentStack& other) const {
+        if (size_ != other.size_)
+            return false;
+        const Node* a = head_;
+        const Node* b = other.head_;
+        for (; a != b; a = a->next, b = b->next) {
+            if (!(a->value == b->value))
+                return false;
+        }
+        return true;
+    }
+
+    bool operator!=(const PersistentStack& other) const {
+        return !(*this == other);
+    }
+
+    readOnlyIterator readOnlyBegin() const {
+        return readOnlyIterator(head_);
+    }
+
+    readOnlyIterator readOnlyEnd() const {
+        return readOnlyIterator(nullptr);
+    }
+
+    /**
+     * @brief Metodo per stampare lo stack (da fondo a cima - sinistra a destra)
+    */
+    friend std::ostream& operator<<(std::ostream& os, const PersistentStack& s) {
+        os << "[ ";
+        if (s.empty()) {
+            os << "stack empty ";
+        }
+        else {
+            std::vector<const T*> elementi;
+            elementi.reserve(s.size_);
+            for (const Node* n = s.head_; n != nullptr; n = n->next) {
+                elementi.push_back(&n->value);
+            }
+            for (auto it = elementi.rbegin(); it != elementi.rend(); ++it) {
+                os << **it << " ";
+            }
+        }
+        os << "]" << '\n';
+        return os;
+    }
+};
+
+#endif
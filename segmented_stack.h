@@ -0,0 +1,572 @@
+#ifndef SEGMENTED_STACK_H
+#define SEGMENTED_STACK_H
+
+#include <cassert>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include "stack.h"
+
+/**
+ * @brief Stack a segmenti: gli elementi stanno in blocchi di ChunkSize elementi che non vengono mai spostati
+ *
+ * Quando un blocco è pieno se ne alloca un altro, senza copiare gli elementi esistenti:
+ * un push costa al più un'allocazione di un blocco e i riferimenti ottenuti con top()
+ * restano validi finché l'elemento è nello stack. Un blocco svuotato dai pop resta
+ * in cache (uno solo) per evitare allocazioni ripetute quando si oscilla sul confine.
+ * Offre la stessa interfaccia push/pop/top/iteratori di Stack.
+*/
+template <typename T, unsigned int ChunkSize = 1024, typename Alloc = std::allocator<T>>
+class SegmentedStack {
+
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                  "SegmentedStack: ChunkSize deve essere una potenza di 2");
+
+private:
+    typedef std::allocator_traits<Alloc> alloc_traits;
+    typedef typename alloc_traits::template rebind_alloc<T*> directory_alloc;
+
+    static_assert(std::is_same<typename alloc_traits::pointer, T*>::value,
+                  "SegmentedStack: Alloc::pointer deve essere T*");
+
+    std::vector<T*, directory_alloc> chunks_;   // blocchi allocati (quelli usati più al massimo uno di scorta)
+    unsigned int max_size_;
+    unsigned int top_;
+    Alloc alloc_;
+
+    T* slot(unsigned int i) const {
+        return chunks_[i / ChunkSize] + (i % ChunkSize);
+    }
+
+    /**
+     * @brief Metodo privato che garantisce un blocco per la cella top_
+     *
+     * @throw std::bad_alloc se non è possibile allocare un nuovo blocco
+    */
+    void ensure_chunk() {
+        if (top_ / ChunkSize == chunks_.size()) {
+            T* chunk = alloc_traits::allocate(alloc_, ChunkSize);
+            try {
+                chunks_.push_back(chunk);
+            } catch (...) {
+                alloc_traits::deallocate(alloc_, chunk, ChunkSize);
+                throw;
+            }
+        }
+    }
+
+    /**
+     * @brief Metodo privato che libera i blocchi oltre quelli usati e uno di scorta
+    */
+    void trim_spare() {
+        std::size_t used = (top_ + ChunkSize - 1) / ChunkSize;
+        while (chunks_.size() > used + 1) {
+            alloc_traits::deallocate(alloc_, chunks_.back(), ChunkSize);
+            chunks_.pop_back();
+        }
+    }
+
+    /**
+     * @brief Metodo privato che scambia blocchi e dimensioni (non l'allocatore)
+    */
+    void swap_storage(SegmentedStack& other) noexcept {
+        chunks_.swap(other.chunks_);
+        std::swap(max_size_, other.max_size_);
+        std::swap(top_, other.top_);
+    }
+
+    /**
+     * @brief Metodo privato che prende i blocchi di other (this senza blocchi, allocatori uguali)
+    */
+    void steal(SegmentedStack& other) noexcept {
+        chunks_ = std::move(other.chunks_);
+        other.chunks_.clear();
+        max_size_ = other.max_size_;
+        top_ = other.top_;
+        other.top_ = 0;
+    }
+
+    void release() {
+        clear();
+        for (T* chunk : chunks_) {
+            alloc_traits::deallocate(alloc_, chunk, ChunkSize);
+        }
+        chunks_.clear();
+    }
+
+public:
+
+    /**
+     * @brief Iteratore random access (da fondo a cima) sugli elementi dei blocchi
+    */
+    template <typename Ref, typename Ptr>
+    class basic_iterator {
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef T                               value_type;
+        typedef ptrdiff_t                       difference_type;
+        typedef Ptr                             pointer;
+        typedef Ref                             reference;
+
+        basic_iterator() : stack_(nullptr), index_(0) {}
+
+        // Conversione iterator -> const_iterator (non il contrario)
+        template <typename R, typename P,
+                  typename = std::enable_if_t<std::is_convertible<P, Ptr>::value>>
+        basic_iterator(const basic_iterator<R, P>& other) : stack_(other.stack_), index_(other.index_) {}
+
+        reference operator*() const {
+            return *stack_->slot(index_);
+        }
+
+        pointer operator->() const {
+            return stack_->slot(index_);
+        }
+
+        reference operator[](difference_type n) const {
+            return *stack_->slot(static_cast<unsigned int>(index_ + n));
+        }
+
+        basic_iterator& operator++() {
+            ++index_;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator tmp(*this);
+            ++index_;
+            return tmp;
+        }
+
+        basic_iterator& operator--() {
+            --index_;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator tmp(*this);
+            --index_;
+            return tmp;
+        }
+
+        basic_iterator& operator+=(difference_type n) {
+            index_ = static_cast<unsigned int>(index_ + n);
+            return *this;
+        }
+
+        basic_iterator& operator-=(difference_type n) {
+            index_ = static_cast<unsigned int>(index_ - n);
+            return *this;
+        }
+
+        basic_iterator operator+(difference_type n) const {
+            return basic_iterator(stack_, static_cast<unsigned int>(index_ + n));
+        }
+
+        friend basic_iterator operator+(difference_type n, const basic_iterator& it) {
+            return it + n;
+        }
+
+        basic_iterator operator-(difference_type n) const {
+            return basic_iterator(stack_, static_cast<unsigned int>(index_ - n));
+        }
+
+        difference_type operator-(const basic_iterator& other) const {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        bool operator==(const basic_iterator& other) const {
+            return index_ == other.index_ && stack_ == other.stack_;
+        }
+
+        bool operator!=(const basic_iterator& other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const basic_iterator& other) const {
+            return index_ < other.index_;
+        }
+
+        bool operator>(const basic_iterator& other) const {
+            return index_ > other.index_;
+        }
+
+        bool operator<=(const basic_iterator& other) const {
+            return index_ <= other.index_;
+        }
+
+        bool operator>=(const basic_iterator& other) const {
+            return index_ >= other.index_;
+        }
+
+    private:
+        friend class SegmentedStack;
+        template <typename R, typename P> friend class basic_iterator;
+
+        basic_iterator(const SegmentedStack* s, unsigned int index) : stack_(s), index_(index) {}
+
+        const SegmentedStack* stack_;
+        unsigned int index_;
+    };
+
+    typedef Alloc allocator_type;
+    typedef basic_iterator<T&, T*> iterator;
+    typedef basic_iterator<const T&, const T*> const_iterator;
+    typedef std::reverse_iterator<const_iterator> readOnlyIterator;
+
+    /**
+     * @brief Costruttore di default (nessun limite) o con dimensione massima
+     *
+     * Non alloca nessun blocco finché non viene inserito il primo elemento.
+     *
+     * @param max_size massima dimensione dello stack
+     * @param alloc allocatore da cui prendere i blocchi
+    */
+    explicit SegmentedStack(unsigned int max_size = UINT_MAX, const Alloc& alloc = Alloc())
+        : chunks_(directory_alloc(alloc)), max_size_(max_size), top_(0), alloc_(alloc) {}
+
+    /**
+     * @brief Costruttore che inizializza lo stack con i valori specificati
+     *
+     * @param first iteratore all'inizio della sequenza di valori da inserire nello stack
+     * @param last iteratore alla fine della sequenza di valori da inserire nello stack
+     * @param alloc allocatore da cui prendere i blocchi
+     *
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    template <typename Iter>
+    SegmentedStack(Iter first, Iter last, const Alloc& alloc = Alloc())
+        : SegmentedStack(static_cast<unsigned int>(std::distance(first, last)), alloc) {
+        fill(first, last);
+    }
+
+    /**
+     * @brief Costruttore di copia
+     *
+     * @param other stack da copiare
+    */
+    SegmentedStack(const SegmentedStack& other)
+        : SegmentedStack(other.max_size_, alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+        for (const T& element : other) {
+            push(element);
+        }
+    }
+
+    /**
+     * @brief Costruttore di copia con allocatore
+     *
+     * @param other stack da copiare
+     * @param alloc allocatore da cui prendere i blocchi della copia
+    */
+    SegmentedStack(const SegmentedStack& other, const Alloc& alloc)
+        : SegmentedStack(other.max_size_, alloc) {
+        for (const T& element : other) {
+            push(element);
+        }
+    }
+
+    /**
+     * @brief Costruttore di spostamento (O(numero di blocchi), nessun elemento viene spostato)
+     *
+     * @param other stack da spostare (rimane vuoto)
+    */
+    SegmentedStack(SegmentedStack&& other) noexcept
+        : chunks_(std::move(other.chunks_)), max_size_(other.max_size_), top_(other.top_), alloc_(std::move(other.alloc_)) {
+        other.chunks_.clear();
+        other.top_ = 0;
+    }
+
+    /**
+     * @brief Costruttore di spostamento con allocatore
+     *
+     * Se alloc è uguale all'allocatore di other i blocchi vengono rubati,
+     * altrimenti gli elementi vengono spostati uno ad uno nei blocchi di alloc.
+     *
+     * @param other stack da spostare (rimane vuoto)
+     * @param alloc allocatore da cui prendere i blocchi
+    */
+    SegmentedStack(SegmentedStack&& other, const Alloc& alloc)
+        : SegmentedStack(other.max_size_, alloc) {
+        if (alloc_ == other.alloc_) {
+            swap_storage(other);
+        }
+        else {
+            for (T& element : other) {
+                push(std::move(element));
+            }
+            other.clear();
+        }
+    }
+
+    /**
+     * @brief Distruttore
+    */
+    ~SegmentedStack() {
+        release();
+    }
+
+    /**
+     * @brief Operatore di assegnazione (copy-and-swap)
+     *
+     * La copia temporanea usa l'allocatore di destinazione (o quello di other se
+     * l'allocatore si propaga in assegnamento), poi viene scambiata con *this.
+     *
+     * @param other stack da copiare
+     *
+     * @return SegmentedStack& riferimento allo stack assegnato
+    */
+    SegmentedStack& operator=(const SegmentedStack& other) {
+        if (this != &other) {
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                SegmentedStack tmp(other, other.alloc_);
+                release();
+                alloc_ = other.alloc_;
+                steal(tmp);
+            }
+            else {
+                SegmentedStack tmp(other, alloc_);
+                swap_storage(tmp);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Operatore di assegnazione di spostamento
+     *
+     * Ruba i blocchi se l'allocatore si propaga o è uguale a quello di other,
+     * altrimenti gli elementi vengono spostati nei blocchi di *this.
+     *
+     * @param other stack da spostare
+     *
+     * @return SegmentedStack& riferimento allo stack assegnato
+    */
+    SegmentedStack& operator=(SegmentedStack&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                               alloc_traits::is_always_equal::value) {
+        if (this != &other) {
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                release();
+                alloc_ = std::move(other.alloc_);
+                steal(other);
+            }
+            else {
+                SegmentedStack tmp(std::move(other), alloc_);
+                swap_storage(tmp);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Metodo per scambiare il contenuto di due stack
+     *
+     * Gli allocatori vengono scambiati solo se si propagano in swap,
+     * altrimenti devono essere uguali.
+     *
+     * @param other stack con cui scambiare il contenuto
+    */
+    void swap(SegmentedStack& other) noexcept {
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+            std::swap(alloc_, other.alloc_);
+        }
+        else {
+            assert(alloc_ == other.alloc_);
+        }
+        swap_storage(other);
+    }
+
+    friend void swap(SegmentedStack& a, SegmentedStack& b) noexcept {
+        a.swap(b);
+    }
+
+    /**
+     * @brief Metodo per ottenere l'allocatore dello stack
+     *
+     * @return Alloc copia dell'allocatore
+    */
+    Alloc get_allocator() const {
+        return alloc_;
+    }
+
+    /**
+     * @brief Operatore di confronto (sul contenuto)
+     *
+     * @param other stack da confrontare
+     *
+     * @return true se gli stack contengono gli stessi elementi
+    */
+    bool operator==(const SegmentedStack& other) const {
+        return top_ == other.top_ && std::equal(begin(), end(), other.begin());
+    }
+
+    bool operator!=(const SegmentedStack& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Metodo per costruire un elemento in cima allo stack a partire dagli argomenti
+     *
+     * Costo nel caso peggiore: un'allocazione di un blocco (nessuna copia di elementi).
+     *
+     * @param args argomenti passati al costruttore di T
+     *
+     * @return T& riferimento all'elemento inserito (stabile fino al suo pop)
+     *
+     * @throw std::length_error se lo stack è pieno
+    */
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        if (top_ == max_size_)
+            throw std::length_error("SegmentedStack overflow in push (top > max_size)");
+        ensure_chunk();
+        T* p = slot(top_);
+        alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+        ++top_;
+        return *p;
+    }
+
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Metodo per rimuovere un elemento in cima allo stack e restituirlo per valore
+     *
+     * @throw std::length_error se lo stack è vuoto
+     *
+     * @return T elemento rimosso
+    */
+    T pop_value() {
+        if (top_ == 0)
+            throw std::length_error("SegmentedStack underflow in pop (top < 0)");
+        T* p = slot(top_ - 1);
+        T value(std::move(*p));
+        alloc_traits::destroy(alloc_, p);
+        --top_;
+        trim_spare();
+        return value;
+    }
+
+    T pop() {
+        return pop_value();
+    }
+
+    /**
+     * @brief Metodo per ottenere l'elemento in cima allo stack
+     *
+     * @return T& riferimento all'elemento in cima (stabile fino al suo pop)
+     *
+     * @throw std::length_error se lo stack è vuoto
+    */
+    T& top() const {
+        if (top_ == 0)
+            throw std::length_error("SegmentedStack underflow in top (top < 0)");
+        return *slot(top_ - 1);
+    }
+
+    /**
+     * @brief Metodo per cancellare tutti gli elementi (resta allocato al più un blocco di scorta)
+    */
+    void clear() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (unsigned int i = 0; i < top_; ++i) {
+                alloc_traits::destroy(alloc_, slot(i));
+            }
+        }
+        top_ = 0;
+        trim_spare();
+    }
+
+    bool empty() const {
+        return top_ == 0;
+    }
+
+    bool full() const {
+        return top_ == max_size_;
+    }
+
+    unsigned int size() const {
+        return top_;
+    }
+
+    unsigned int max_size() const {
+        return max_size_;
+    }
+
+    /**
+     * @brief Metodo per ottenere il numero di blocchi allocati (inclusa la scorta)
+    */
+    unsigned int chunks() const {
+        return static_cast<unsigned int>(chunks_.size());
+    }
+
+    /**
+     * @brief Metodo pubblico per riempire lo stack con una nuova sequenza di elementi
+     *
+     * @param first iteratore all'inizio della sequenza
+     * @param last iteratore alla fine della sequenza
+     *
+     * @throw std::length_error se la sequenza è più lunga della dimensione massima
+    */
+    template <typename Iter>
+    void fill(Iter first, Iter last) {
+        if (static_cast<unsigned long long>(std::distance(first, last)) > max_size_)
+            throw std::length_error("Errore fill(): la sequenza di elementi è più lunga di quella dello stack");
+        clear();
+        for (; first != last; ++first) {
+            push(*first);
+        }
+    }
+
+    template <typename P>
+    bool checkif(const P& predicate, const T &element) const {
+        return predicate(element);
+    }
+
+    friend std::ostream& operator<<(std::ostream &os, const SegmentedStack &s) {
+        os << "[ ";
+        if (s.empty()) {
+            os << "stack empty ";
+        }
+        else {
+            for (const T& element : s) {
+                os << element << " ";
+            }
+        }
+        os << "]" << '\n';
+        return os;
+    }
+
+    // Iteratori da fondo a cima
+    iterator begin() {
+        return iterator(this, 0);
+    }
+
+    iterator end() {
+        return iterator(this, top_);
+    }
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, top_);
+    }
+
+    // Iteratori di sola lettura da cima a fondo
+    readOnlyIterator readOnlyBegin() const {
+        return readOnlyIterator(end());
+    }
+
+    readOnlyIterator readOnlyEnd() const {
+        return readOnlyIterator(begin());
+    }
+};
+
+#endif
@@ -0,0 +1,558 @@
+#ifndef SMALL_STACK_H
+#define SMALL_STACK_H
+
+#include <iterator>
+#include "stack.h"
+
+/**
+ * @brief Stack con i primi N elementi memorizzati dentro l'oggetto (small buffer optimization)
+ *
+ * Finché lo stack contiene al più N elementi non viene fatta nessuna allocazione
+ * sull'heap; oltre N gli elementi vengono spostati in un buffer allocato con Alloc.
+ * Offre la stessa interfaccia push/pop/top/iteratori di Stack.
+*/
+template <typename T, unsigned int N = 16, typename Alloc = std::allocator<T>>
+class SmallStack {
+
+    static_assert(N > 0, "SmallStack: N deve essere maggiore di 0");
+
+public:
+    typedef Alloc allocator_type;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::reverse_iterator<const T*> readOnlyIterator;
+
+private:
+    typedef std::allocator_traits<Alloc> alloc_traits;
+
+    static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                  "SmallStack: Alloc::value_type deve essere T");
+    static_assert(std::is_same<typename alloc_traits::pointer, T*>::value,
+                  "SmallStack: Alloc::pointer deve essere T*");
+
+    T* stack_;
+    unsigned int max_size_;
+    unsigned int top_;
+    StackGrowth growth_;
+    unsigned int limit_;    // limite massimo per gli stack Fixed (UINT_MAX se Geometric)
+    Alloc alloc_;
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+
+    /**
+     * @brief Metodo privato che ritorna l'inizio del buffer interno
+    */
+    T* inline_data() {
+        return reinterpret_cast<T*>(inline_);
+    }
+
+    /**
+     * @brief Metodo privato che ritorna true se gli elementi sono nel buffer interno
+    */
+    bool is_inline() const {
+        return stack_ == reinterpret_cast<const T*>(inline_);
+    }
+
+    template <typename... Args>
+    void construct(T* p, Args&&... args) {
+        alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+    }
+
+    void destroy(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) {
+                alloc_traits::destroy(alloc_, first);
+            }
+        }
+    }
+
+    /**
+     * @brief Metodo privato che libera il buffer sull'heap (se presente) e torna al buffer interno
+    */
+    void release_heap() {
+        if (!is_inline())
+            alloc_traits::deallocate(alloc_, stack_, max_size_);
+        stack_ = inline_data();
+        max_size_ = N;
+    }
+
+    /**
+     * @brief Metodo privato che sposta gli elementi vivi in [dst, dst + top_) e distrugge gli originali
+     *
+     * @param dst memoria non inizializzata di destinazione
+    */
+    void relocate(T* dst) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (top_ > 0)
+                std::memcpy(static_cast<void*>(dst), stack_, top_ * sizeof(T));
+        }
+        else {
+            unsigned int i = 0;
+            try {
+                for (; i < top_; ++i) {
+                    construct(dst + i, std::move_if_noexcept(stack_[i]));
+                }
+            } catch (...) {
+                destroy(dst, dst + i);
+                throw;
+            }
+            destroy(stack_, stack_ + top_);
+        }
+    }
+
+    /**
+     * @brief Metodo privato che rialloca lo stack con la nuova capacità specificata
+     *
+     * Se new_size <= N gli elementi tornano nel buffer interno.
+     *
+     * @param new_size nuova capacità dello stack (>= top_)
+     *
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    void reallocate(unsigned int new_size) {
+        if (new_size <= N) {
+            if (is_inline())
+                return;
+            T* old = stack_;
+            unsigned int old_size = max_size_;
+            relocate(inline_data());
+            alloc_traits::deallocate(alloc_, old, old_size);
+            stack_ = inline_data();
+            max_size_ = N;
+            return;
+        }
+        T* tmp = alloc_traits::allocate(alloc_, new_size);
+        try {
+            relocate(tmp);
+        } catch (...) {
+            alloc_traits::deallocate(alloc_, tmp, new_size);
+            throw;
+        }
+        if (!is_inline())
+            alloc_traits::deallocate(alloc_, stack_, max_size_);
+        stack_ = tmp;
+        max_size_ = new_size;
+    }
+
+    /**
+     * @brief Metodo privato che fa crescere geometricamente la capacità dello stack
+     *
+     * @throw std::length_error se la capacità ha già raggiunto il massimo rappresentabile
+    */
+    void grow() {
+        if (max_size_ == UINT_MAX)
+            throw std::length_error("SmallStack overflow in grow (max_size == UINT_MAX)");
+        reallocate(max_size_ > UINT_MAX / 2 ? UINT_MAX : max_size_ * 2);
+    }
+
+    /**
+     * @brief Metodo privato che controlla se c'è spazio per un nuovo elemento in cima
+     *
+     * @param what messaggio dell'eccezione
+     *
+     * @return true se lo stack deve crescere prima dell'inserimento
+     *
+     * @throw std::length_error se lo stack è pieno e non è Geometric
+    */
+    bool needs_grow(const char* what) const {
+        if (top_ < max_size_ && top_ < limit_)
+            return false;
+        if (growth_ != StackGrowth::Geometric)
+            throw std::length_error(what);
+        return true;
+    }
+
+public:
+
+    /**
+     * @brief Costruttore di default: N elementi interni, poi crescita geometrica sull'heap
+     *
+     * @param alloc allocatore da cui prendere la memoria oltre gli N elementi interni
+    */
+    explicit SmallStack(const Alloc& alloc = Alloc())
+        : stack_(inline_data()), max_size_(N), top_(0), growth_(StackGrowth::Geometric), limit_(UINT_MAX), alloc_(alloc) {}
+
+    /**
+     * @brief Costruttore che inizializza lo stack con la dimensione massima specificata
+     *
+     * Se max_size <= N non viene fatta nessuna allocazione.
+     *
+     * @param max_size massima dimensione dello stack (capacità iniziale se growth è Geometric)
+     * @param growth politica di crescita dello stack (di default Fixed)
+     * @param alloc allocatore da cui prendere la memoria oltre gli N elementi interni
+     *
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    SmallStack(unsigned int max_size, StackGrowth growth = StackGrowth::Fixed, const Alloc& alloc = Alloc())
+        : stack_(inline_data()), max_size_(N), top_(0), growth_(growth),
+          limit_(growth == StackGrowth::Fixed ? max_size : UINT_MAX), alloc_(alloc) {
+        reserve(max_size);
+    }
+
+    /**
+     * @brief Costruttore che inizializza lo stack con i valori specificati
+     *
+     * @param first iteratore all'inizio della sequenza di valori da inserire nello stack
+     * @param last iteratore alla fine della sequenza di valori da inserire nello stack
+     * @param alloc allocatore da cui prendere la memoria oltre gli N elementi interni
+     *
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    template <typename Iter>
+    SmallStack(Iter first, Iter last, const Alloc& alloc = Alloc())
+        : SmallStack(static_cast<unsigned int>(last - first), StackGrowth::Fixed, alloc) {
+        // il costruttore delegato è già completo: se fill() lancia, il distruttore libera tutto
+        fill(first, last);
+    }
+
+    /**
+     * @brief Costruttore di copia (copia solo gli elementi vivi)
+     *
+     * @param other stack da copiare
+    */
+    SmallStack(const SmallStack& other)
+        : stack_(inline_data()), max_size_(N), top_(0), growth_(other.growth_), limit_(other.limit_),
+          alloc_(alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+        try {
+            reserve(other.top_);
+            for (; top_ < other.top_; ++top_) {
+                construct(stack_ + top_, other.stack_[top_]);
+            }
+        } catch (...) {
+            clear();
+            release_heap();
+            throw;
+        }
+    }
+
+    /**
+     * @brief Costruttore di spostamento
+     *
+     * Il buffer sull'heap viene rubato in O(1) (l'allocatore viene spostato insieme a lui);
+     * gli elementi interni (al più N) vengono spostati. Non alloca mai.
+     *
+     * @param other stack da spostare (rimane vuoto)
+    */
+    SmallStack(SmallStack&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : stack_(inline_data()), max_size_(N), top_(0), growth_(other.growth_), limit_(other.limit_), alloc_(std::move(other.alloc_)) {
+        take(other, true);
+    }
+
+    /**
+     * @brief Distruttore
+    */
+    ~SmallStack() {
+        clear();
+        release_heap();
+    }
+
+    /**
+     * @brief Operatore di assegnazione (copy-and-swap)
+     *
+     * @param other stack da copiare
+     *
+     * @return SmallStack& riferimento allo stack assegnato
+    */
+    SmallStack& operator=(const SmallStack& other) {
+        if (this != &other) {
+            SmallStack tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Operatore di assegnazione di spostamento
+     *
+     * L'allocatore non si propaga: se è diverso da quello di other gli elementi
+     * vengono spostati uno ad uno.
+     *
+     * @param other stack da spostare (rimane vuoto)
+     *
+     * @return SmallStack& riferimento allo stack assegnato
+    */
+    SmallStack& operator=(SmallStack&& other) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                                       alloc_traits::is_always_equal::value) {
+        if (this != &other) {
+            clear();
+            release_heap();
+            growth_ = other.growth_;
+            limit_ = other.limit_;
+            take(other, alloc_ == other.alloc_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Metodo per scambiare il contenuto di due stack
+     *
+     * @param other stack con cui scambiare il contenuto
+    */
+    void swap(SmallStack& other) {
+        SmallStack tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    friend void swap(SmallStack& a, SmallStack& b) {
+        a.swap(b);
+    }
+
+    /**
+     * @brief Operatore di confronto (solo sul contenuto)
+     *
+     * @param other stack da confrontare
+     *
+     * @return true se gli stack contengono gli stessi elementi
+    */
+    bool operator==(const SmallStack& other) const {
+        if (top_ != other.top_)
+            return false;
+        for (unsigned int i = 0; i < top_; ++i) {
+            if (!(stack_[i] == other.stack_[i]))
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima allo stack
+     *
+     * @param value valore da inserire
+     *
+     * @throw std::length_error se lo stack è pieno (e non è Geometric) e si prova ad inserire un elemento
+    */
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima allo stack spostandolo
+     *
+     * @param value valore da spostare nello stack
+     *
+     * @throw std::length_error se lo stack è pieno (e non è Geometric) e si prova ad inserire un elemento
+    */
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    /**
+     * @brief Metodo per costruire un elemento in cima allo stack a partire dagli argomenti
+     *
+     * @param args argomenti passati al costruttore di T
+     *
+     * @return T& riferimento all'elemento inserito
+     *
+     * @throw std::length_error se lo stack è pieno (e non è Geometric) e si prova ad inserire un elemento
+    */
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        if (needs_grow("SmallStack overflow in push (top > max_size)")) {
+            // gli argomenti potrebbero riferirsi ad elementi dello stack stesso
+            T tmp(std::forward<Args>(args)...);
+            grow();
+            construct(stack_ + top_, std::move(tmp));
+            return stack_[top_++];
+        }
+        construct(stack_ + top_, std::forward<Args>(args)...);
+        return stack_[top_++];
+    }
+
+    /**
+     * @brief Metodo per rimuovere un elemento in cima allo stack e restituirlo
+     *
+     * @throw std::length_error se lo stack è vuoto e si prova a rimuovere un elemento
+     *
+     * @return T elemento rimosso
+    */
+    T pop() {
+        return pop_value();
+    }
+
+    /**
+     * @brief Metodo per rimuovere un elemento in cima allo stack e restituirlo per valore
+     *
+     * @throw std::length_error se lo stack è vuoto e si prova a rimuovere un elemento
+     *
+     * @return T elemento rimosso
+    */
+    T pop_value() {
+        if (top_ == 0)
+            throw std::length_error("SmallStack underflow in pop (top < 0)");
+        T value(std::move(stack_[top_ - 1]));
+        --top_;
+        destroy(stack_ + top_, stack_ + top_ + 1);
+        return value;
+    }
+
+    /**
+     * @brief Metodo per ottenere l'elemento in cima allo stack
+     *
+     * @return T& riferimento all'elemento in cima allo stack
+     *
+     * @throw std::length_error se lo stack è vuoto
+    */
+    T& top() const {
+        if (top_ == 0)
+            throw std::length_error("SmallStack underflow in top (top < 0)");
+        return stack_[top_ - 1];
+    }
+
+    /**
+     * @brief Metodo per cancellare tutti gli elementi dello stack (la capacità resta)
+    */
+    void clear() {
+        destroy(stack_, stack_ + top_);
+        top_ = 0;
+    }
+
+    bool empty() const {
+        return top_ == 0;
+    }
+
+    bool full() const {
+        return top_ == max_size();
+    }
+
+    unsigned int size() const {
+        return top_;
+    }
+
+    /**
+     * @brief Metodo per ottenere la dimensione massima dello stack
+     *
+     * @return unsigned int dimensione massima (capacità attuale se growth è Geometric)
+    */
+    unsigned int max_size() const {
+        return max_size_ < limit_ ? max_size_ : limit_;
+    }
+
+    StackGrowth growth() const {
+        return growth_;
+    }
+
+    /**
+     * @brief Metodo per sapere se gli elementi sono ancora nel buffer interno (nessuna allocazione)
+     *
+     * @return true se lo stack non usa memoria sull'heap
+    */
+    bool is_small() const {
+        return is_inline();
+    }
+
+    /**
+     * @brief Metodo per riservare spazio per almeno new_size elementi
+     *
+     * @param new_size capacità minima richiesta
+     *
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    void reserve(unsigned int new_size) {
+        if (new_size > max_size_)
+            reallocate(new_size);
+        if (growth_ == StackGrowth::Fixed && new_size > limit_)
+            limit_ = new_size;
+    }
+
+    /**
+     * @brief Metodo per ridurre la capacità al numero di elementi (torna interno se size() <= N)
+     *
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    void shrink_to_fit() {
+        if (top_ < max_size_ && !is_inline())
+            reallocate(top_);
+    }
+
+    /**
+     * @brief Metodo pubblico per riempire lo stack con una nuova sequenza di elementi
+     *
+     * @param first iteratore all'inizio della sequenza
+     * @param last iteratore alla fine della sequenza
+     *
+     * @throw std::length_error se la sequenza è più lunga dello stack (e non è Geometric)
+    */
+    template <typename Iter>
+    void fill(Iter first, Iter last) {
+        unsigned int n = static_cast<unsigned int>(last - first);
+        if (n > max_size() && growth_ != StackGrowth::Geometric)
+            throw std::length_error("Errore fill(): la sequenza di elementi è più lunga di quella dello stack");
+        clear();
+        reserve(n);
+        for (; first != last; ++first) {
+            construct(stack_ + top_, *first);
+            ++top_;
+        }
+    }
+
+    template <typename P>
+    bool checkif(const P& predicate, const T &element) const {
+        return predicate(element);
+    }
+
+    friend std::ostream& operator<<(std::ostream &os, const SmallStack &s) {
+        os << "[ ";
+        if (s.empty()) {
+            os << "stack empty ";
+        }
+        else {
+            for (unsigned int i = 0; i < s.top_; i++) {
+                os << s.stack_[i] << " ";
+            }
+        }
+        os << "]" << '\n';
+        return os;
+    }
+
+    // Iteratori da fondo a cima
+    iterator begin() {
+        return stack_;
+    }
+
+    iterator end() {
+        return stack_ + top_;
+    }
+
+    const_iterator begin() const {
+        return stack_;
+    }
+
+    const_iterator end() const {
+        return stack_ + top_;
+    }
+
+    // Iteratori di sola lettura da cima a fondo
+    readOnlyIterator readOnlyBegin() const {
+        return readOnlyIterator(stack_ + top_);
+    }
+
+    readOnlyIterator readOnlyEnd() const {
+        return readOnlyIterator(stack_);
+    }
+
+private:
+
+    /**
+     * @brief Metodo privato che prende il contenuto di other (this deve essere vuoto e interno)
+     *
+     * @param other stack da cui prendere gli elementi (rimane vuoto e interno)
+     * @param same_alloc true se alloc_ può liberare il buffer di other (allora non alloca)
+    */
+    void take(SmallStack& other, bool same_alloc) {
+        if (other.is_inline() || !same_alloc) {
+            reserve(other.top_);
+            other.relocate(stack_);
+            top_ = other.top_;
+        }
+        else {
+            stack_ = other.stack_;
+            max_size_ = other.max_size_;
+            top_ = other.top_;
+            other.stack_ = other.inline_data();
+            other.max_size_ = N;
+        }
+        other.top_ = 0;
+    }
+};
+
+#endif
@@ -1,36 +1,745 @@
 #ifndef STACK_H
 #define STACK_H
 
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include <cstring>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <iterator>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <optional>
+#include "stack_stats.h"
+#include "stack_check.h"
+
+// Con STACK_PARALLEL definita le interrogazioni su tutto lo stack (count_if, any_of, ...)
+// usano std::execution::par_unseq sopra Stack::parallel_threshold elementi.
+// Con libstdc++ serve collegare TBB (-ltbb).
+#if defined(STACK_PARALLEL)
+#include <execution>
+#define STACK_PAR_ALGO(algo, n, ...) \
+    ((n) >= parallel_threshold ? std::algo(std::execution::par_unseq, __VA_ARGS__) : std::algo(__VA_ARGS__))
+#else
+#define STACK_PAR_ALGO(algo, n, ...) std::algo(__VA_ARGS__)
+#endif
+
+/**
+ * @brief Politica di crescita dello stack
+ * 
+ * Fixed: la capacità è un limite, push() su stack pieno lancia std::length_error
+ * Geometric: quando lo stack è pieno la capacità viene raddoppiata (push() ammortizzato O(1))
+*/
+enum class StackGrowth { Fixed, Geometric };
+
+/**
+ * @brief Punto di salvataggio restituito da Stack::mark() (la dimensione al momento del mark)
+ * 
+ * I mark si annidano come gli elementi: tornare a un mark esterno rende non validi 
+ * quelli presi dopo. Un mark è valido finché lo stack non scende sotto la sua dimensione.
+ * stamp identifica il mark in debug (vedi StackMarkLog), altrimenti vale 0.
+*/
+struct StackMark {
+    unsigned int size;
+    std::uint64_t stamp;
+};
+
+#ifdef NDEBUG
+const bool STACK_CHECK_MARKS = false;
+#else
+const bool STACK_CHECK_MARKS = true;
+#endif
+
+/**
+ * @brief Registro dei mark ancora validi di uno Stack, per riconoscere in debug i mark scaduti
+ * 
+ * I mark validi hanno dimensioni strettamente crescenti, ciascuno con un timbro unico: quando
+ * lo stack scende sotto la dimensione di un mark questo esce dal registro, quindi un mark il
+ * cui timbro non c'è più è scaduto anche se lo stack è poi risalito sopra di esso.
+ * Due mark presi alla stessa dimensione senza discese in mezzo condividono il timbro.
+ * Con Enabled == false non occupa memoria e non fa nulla.
+*/
+template <bool Enabled>
+class StackMarkLog {
+
+public:
+    StackMarkLog() : clock_(0) {}
+
+    /**
+     * @brief Metodo che registra un mark alla dimensione size e ne restituisce il timbro
+     * 
+     * @throw std::bad_alloc se non è possibile allocare lo spazio per il registro
+    */
+    std::uint64_t take(unsigned int size) {
+        if (live_.empty() || live_.back().size != size)
+            live_.push_back(StackMark{size, ++clock_});
+        return live_.back().stamp;
+    }
+
+    /**
+     * @brief Metodo che toglie i mark più alti di top (lo stack è sceso a top elementi)
+    */
+    void lower(unsigned int top) noexcept {
+        while (!live_.empty() && live_.back().size > top) {
+            live_.pop_back();
+        }
+    }
+
+    bool valid(StackMark m) const {
+        auto it = std::lower_bound(live_.begin(), live_.end(), m.size, 
+                                   [](const StackMark& a, unsigned int size) { return a.size < size; });
+        return it != live_.end() && it->size == m.size && it->stamp == m.stamp;
+    }
+
+private:
+    std::vector<StackMark> live_;
+    std::uint64_t clock_;           // non torna mai indietro: un timbro non viene riusato
+};
+
+template <>
+class StackMarkLog<false> {
+
+public:
+    std::uint64_t take(unsigned int) {
+        return 0;
+    }
+
+    void lower(unsigned int) noexcept {}
+
+    bool valid(StackMark) const {
+        return true;
+    }
+};
+
+/**
+ * @brief Trait che vale true se Iter ha il marcatore is_contiguous (iteratori di Stack)
+*/
+template <typename Iter, typename = void>
+struct has_contiguous_marker : std::false_type {};
+
+template <typename Iter>
+struct has_contiguous_marker<Iter, std::void_t<typename Iter::is_contiguous>> : Iter::is_contiguous {};
+
+/**
+ * @brief Trait che vale true se Iter scorre elementi contigui in memoria
+ * (puntatori, iteratori di std::vector e di Stack), per cui una sequenza può essere copiata con memcpy
+*/
+template <typename Iter, typename V = typename std::iterator_traits<Iter>::value_type,
+          bool = std::is_object<V>::value && !std::is_same<V, bool>::value>
+struct is_contiguous_iterator : std::is_pointer<Iter> {};
+
+template <typename Iter, typename V>
+struct is_contiguous_iterator<Iter, V, true> 
+    : std::integral_constant<bool, std::is_pointer<Iter>::value ||
+                                   has_contiguous_marker<Iter>::value ||
+                                   std::is_same<Iter, typename std::vector<V>::iterator>::value ||
+                                   std::is_same<Iter, typename std::vector<V>::const_iterator>::value> {};
+
+/**
+ * @brief Trait che vale true se due T sono uguali esattamente quando lo sono i loro byte
+ * 
+ * Abilita memcmp in operator== e l'hash sui byte del buffer. Di default vale solo per
+ * i tipi scalari con rappresentazione unica (interi, enum, puntatori): per un tipo utente
+ * operator== può ignorare dei campi. Un tipo utente per cui l'uguaglianza è davvero
+ * quella dei byte può specializzare il trait a std::true_type.
+*/
 template <typename T>
+struct stack_bitwise_equal 
+    : std::integral_constant<bool, std::is_scalar<T>::value && std::has_unique_object_representations<T>::value> {};
+
+/**
+ * @brief Funzione di hash di un blocco di byte (schema xxHash64)
+ * 
+ * Quattro accumulatori indipendenti consumano 32 byte per iterazione, così la CPU
+ * (o il compilatore, con le estensioni vettoriali) li elabora in parallelo.
+ * 
+ * @param data inizio del blocco
+ * @param len lunghezza in byte
+ * @param seed seme dell'hash
+ * 
+ * @return std::uint64_t hash del blocco
+*/
+inline std::uint64_t stack_hash_bytes(const void* data, std::size_t len, std::uint64_t seed = 0) {
+    const std::uint64_t P1 = 0x9E3779B185EBCA87ULL;
+    const std::uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+    const std::uint64_t P3 = 0x165667B19E3779F9ULL;
+    const std::uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+    const std::uint64_t P5 = 0x27D4EB2F165667C5ULL;
+
+    auto rotl = [](std::uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+    auto mix = [&](std::uint64_t acc, std::uint64_t input) { return rotl(acc + input * P2, 31) * P1; };
+    auto read64 = [](const unsigned char* p) { std::uint64_t v; std::memcpy(&v, p, 8); return v; };
+
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const unsigned char* end = p + len;
+    std::uint64_t h;
+
+    if (len >= 32) {
+        std::uint64_t acc[4] = {seed + P1 + P2, seed + P2, seed, seed - P1};
+        for (; p + 32 <= end; p += 32) {
+            for (int l = 0; l < 4; ++l) {
+                acc[l] = mix(acc[l], read64(p + 8 * l));
+            }
+        }
+        h = rotl(acc[0], 1) + rotl(acc[1], 7) + rotl(acc[2], 12) + rotl(acc[3], 18);
+        for (int l = 0; l < 4; ++l) {
+            h = (h ^ mix(0, acc[l])) * P1 + P4;
+        }
+    }
+    else {
+        h = seed + P5;
+    }
+
+    h += static_cast<std::uint64_t>(len);
+    for (; p + 8 <= end; p += 8) {
+        h = rotl(h ^ mix(0, read64(p)), 27) * P1 + P4;
+    }
+    for (; p < end; ++p) {
+        h = rotl(h ^ (*p * P5), 11) * P1;
+    }
+
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
+
+/**
+ * @brief Header del formato binario di Stack (save/load, serialize/deserialize)
+ * 
+ * I campi sono scritti nell'ordine di byte nativo: il formato serve a scambiare snapshot
+ * tra processi sulla stessa architettura. Il checksum è stack_hash_bytes del payload.
+*/
+struct StackBinaryHeader {
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t flags;            // STACK_BINARY_RAW: il payload è il blocco grezzo degli elementi
+    std::uint32_t element_size;
+    std::uint32_t reserved;
+    std::uint64_t count;
+    std::uint64_t payload_size;
+    std::uint64_t checksum;
+};
+
+const std::uint16_t STACK_BINARY_VERSION = 1;
+const std::uint16_t STACK_BINARY_RAW = 1;
+
+/**
+ * @brief Codec per elemento usato da save()/load() per i T non trivially copyable
+ * 
+ * Va specializzato per ogni tipo da serializzare con due funzioni statiche:
+ * void write(std::ostream&, const T&) e T read(std::istream&).
+ * I T trivially copyable non ne hanno bisogno: vengono scritti come un unico blocco.
+*/
+template <typename T>
+struct StackCodec;
+
+/**
+ * @brief Codec per std::string (lunghezza a 64 bit seguita dai caratteri)
+*/
+template <>
+struct StackCodec<std::string> {
+    static void write(std::ostream& os, const std::string& value) {
+        std::uint64_t n = value.size();
+        os.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        os.write(value.data(), static_cast<std::streamsize>(n));
+    }
+
+    static std::string read(std::istream& is) {
+        std::uint64_t n = 0;
+        if (!is.read(reinterpret_cast<char*>(&n), sizeof(n)))
+            throw std::runtime_error("StackCodec<std::string>: lunghezza mancante");
+        std::string value(static_cast<std::size_t>(n), '\0');
+        if (!is.read(&value[0], static_cast<std::streamsize>(n)))
+            throw std::runtime_error("StackCodec<std::string>: caratteri mancanti");
+        return value;
+    }
+};
+
+/**
+ * @brief Stack generico con capacità fissa o crescita geometrica
+ * 
+ * @tparam T tipo degli elementi
+ * @tparam Alloc allocatore della memoria degli elementi
+ * @tparam Stats politica di strumentazione (NoStackStats: nessun costo, StackStats: contatori)
+ * @tparam Check politica di controllo dei limiti (StackCheckThrow, StackCheckAssert, StackCheckNone)
+*/
+template <typename T, typename Alloc = std::allocator<T>, typename Stats = NoStackStats, typename Check = StackCheckThrow>
 class Stack {
 
+public:
+    typedef Alloc allocator_type;
+
 private:
+    typedef std::allocator_traits<Alloc> alloc_traits;
+
+    static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                  "Stack: Alloc::value_type deve essere T");
+    static_assert(std::is_same<typename alloc_traits::pointer, T*>::value,
+                  "Stack: Alloc::pointer deve essere T*");
+
     T* stack_;
     unsigned int max_size_;
     unsigned int top_;
+    StackGrowth growth_;
+    Alloc alloc_;
+    mutable Stats stats_;
+    mutable StackMarkLog<Check::enabled && STACK_CHECK_MARKS> marks_;
+
+    /**
+     * @brief Metodo privato che alloca memoria grezza (non inizializzata) per n elementi
+     * 
+     * @param n numero di elementi
+     * 
+     * @return T* puntatore alla memoria allocata (nullptr se n == 0)
+     * 
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario
+    */
+    T* allocate(unsigned int n) {
+        if (n == 0)
+            return nullptr;
+        T* p = alloc_traits::allocate(alloc_, n);
+        stats_.on_allocate(static_cast<std::size_t>(n) * sizeof(T));
+        return p;
+    }
+
+    /**
+     * @brief Metodo privato che libera la memoria grezza allocata con allocate()
+     * 
+     * @param p puntatore alla memoria
+     * @param n numero di elementi allocati
+    */
+    void deallocate(T* p, unsigned int n) {
+        if (p != nullptr)
+            alloc_traits::deallocate(alloc_, p, n);
+    }
+
+    /**
+     * @brief Metodo privato che costruisce un elemento sul posto tramite l'allocatore
+     * 
+     * @param p indirizzo della cella non inizializzata
+     * @param args argomenti passati al costruttore di T
+    */
+    template <typename... Args>
+    void construct(T* p, Args&&... args) {
+        alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Metodo privato che distrugge gli elementi in [first, last) tramite l'allocatore
+     * 
+     * @param first primo elemento da distruggere
+     * @param last elemento successivo all'ultimo da distruggere
+    */
+    void destroy(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; first != last; ++first) {
+                alloc_traits::destroy(alloc_, first);
+            }
+        }
+    }
+
+    /**
+     * @brief Metodo privato che distrugge tutti gli elementi vivi e libera la memoria
+    */
+    void release() {
+        destroy(stack_, stack_ + top_);
+        deallocate(stack_, max_size_);
+        stack_ = nullptr;
+        max_size_ = 0;
+        top_ = 0;
+        marks_.lower(0);
+    }
+
+    /**
+     * @brief Metodo privato che copia gli elementi vivi di other in memoria non inizializzata
+     * 
+     * @param other stack da cui copiare i primi other.top_ elementi
+    */
+    void copy_from(const Stack& other) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (other.top_ > 0)
+                std::memcpy(static_cast<void*>(stack_), other.stack_, other.top_ * sizeof(T));
+        }
+        else {
+            for (; top_ < other.top_; ++top_) {
+                construct(stack_ + top_, other.stack_[top_]);
+            }
+        }
+        top_ = other.top_;
+        stats_.on_size(top_);
+    }
+
+    /**
+     * @brief Metodo privato che sposta gli elementi vivi di other in memoria non inizializzata
+     * 
+     * @param other stack da cui spostare i primi other.top_ elementi
+    */
+    void move_from(Stack& other) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (other.top_ > 0)
+                std::memcpy(static_cast<void*>(stack_), other.stack_, other.top_ * sizeof(T));
+        }
+        else {
+            for (; top_ < other.top_; ++top_) {
+                construct(stack_ + top_, std::move(other.stack_[top_]));
+            }
+        }
+        top_ = other.top_;
+        stats_.on_size(top_);
+    }
+
+    /**
+     * @brief Metodo privato che prende il buffer di other (allocatori uguali), lasciandolo vuoto
+     * 
+     * @param other stack da cui prendere il buffer
+    */
+    void steal(Stack& other) noexcept {
+        stack_ = other.stack_;
+        max_size_ = other.max_size_;
+        top_ = other.top_;
+        growth_ = other.growth_;
+        stats_.on_size(top_);
+        other.stack_ = nullptr;
+        other.max_size_ = 0;
+        other.top_ = 0;
+        other.marks_.lower(0);
+    }
+
+    /**
+     * @brief Metodo privato che scambia buffer e stato di due stack, ma non gli allocatori
+     * 
+     * @param other stack con cui scambiare il buffer
+    */
+    void swap_storage(Stack& other) noexcept {
+        std::swap(stack_, other.stack_);
+        std::swap(max_size_, other.max_size_);
+        std::swap(top_, other.top_);
+        std::swap(growth_, other.growth_);
+        marks_.lower(0);
+        other.marks_.lower(0);
+    }
+
+    /**
+     * @brief Metodo privato che rialloca lo stack con la nuova capacità specificata
+     * 
+     * Gli elementi vivi vengono spostati (memcpy per tipi trivially copyable, 
+     * move per gli altri) invece che copiati.
+     * 
+     * @param new_size nuova capacità dello stack (>= top_)
+     * 
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    void reallocate(unsigned int new_size) {
+        T* tmp = allocate(new_size);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (top_ > 0)
+                std::memcpy(static_cast<void*>(tmp), stack_, top_ * sizeof(T));
+        }
+        else {
+            unsigned int i = 0;
+            try {
+                for (; i < top_; ++i) {
+                    construct(tmp + i, std::move_if_noexcept(stack_[i]));
+                }
+            } catch (...) {
+                destroy(tmp, tmp + i);
+                deallocate(tmp, new_size);
+                throw;
+            }
+            destroy(stack_, stack_ + top_);
+        }
+        deallocate(stack_, max_size_);
+        stack_ = tmp;
+        max_size_ = new_size;
+        stats_.on_reallocate();
+    }
+
+    /**
+     * @brief Metodo privato che garantisce spazio per altri n elementi (un solo controllo per blocco)
+     * 
+     * @param n numero di elementi da inserire
+     * @param what messaggio dell'eccezione
+     * 
+     * @throw std::length_error se lo stack non ha spazio (e non è Geometric)
+    */
+    void ensure_room(unsigned int n, const char* what) {
+        if (n <= max_size_ - top_)
+            return;
+        if (growth_ != StackGrowth::Geometric || n > UINT_MAX - top_) {
+            stats_.on_overflow();
+            throw std::length_error(what);
+        }
+        unsigned int needed = top_ + n;
+        unsigned int doubled = max_size_ > UINT_MAX / 2 ? UINT_MAX : max_size_ * 2;
+        reallocate(needed > doubled ? needed : doubled);
+    }
+
+    /**
+     * @brief Metodo privato che costruisce in cima gli n elementi di [first, first + n)
+     * 
+     * Lo spazio deve essere già garantito. Per sequenze contigue di T trivially copyable 
+     * si riduce ad una sola memcpy.
+     * 
+     * @param first iteratore all'inizio della sequenza
+     * @param n numero di elementi
+    */
+    template <typename Iter>
+    void append(Iter first, unsigned int n) {
+        typedef typename std::remove_cv<typename std::iterator_traits<Iter>::value_type>::type value_type;
+        if constexpr (is_contiguous_iterator<Iter>::value && std::is_same<value_type, T>::value &&
+                      std::is_trivially_copyable<T>::value) {
+            if (n > 0)
+                std::memcpy(static_cast<void*>(stack_ + top_), std::addressof(*first), n * sizeof(T));
+            top_ += n;
+        }
+        else {
+            for (unsigned int i = 0; i < n; ++i, ++first) {
+                construct(stack_ + top_, *first);
+                ++top_;
+            }
+        }
+        stats_.on_size(top_);
+    }
+
+    /**
+     * @brief Metodo privato che fa crescere geometricamente la capacità dello stack
+     * 
+     * @throw std::length_error se la capacità ha già raggiunto il massimo rappresentabile
+    */
+    void grow() {
+        if (max_size_ == UINT_MAX) {
+            stats_.on_overflow();
+            throw std::length_error("Stack overflow in grow (max_size == UINT_MAX)");
+        }
+        if (max_size_ == 0)
+            reallocate(8);
+        else if (max_size_ > UINT_MAX / 2)
+            reallocate(UINT_MAX);
+        else
+            reallocate(max_size_ * 2);
+    }
+
+    /**
+     * @brief Metodo privato che segnala un overflow secondo la politica Check
+     * 
+     * @param what messaggio dell'errore
+    */
+    void overflow(const char* what) const {
+        if constexpr (Check::enabled) {
+            stats_.on_overflow();
+            Check::overflow(what);
+        }
+    }
+
+    /**
+     * @brief Metodo privato che segnala un underflow secondo la politica Check
+     * 
+     * @param what messaggio dell'errore
+    */
+    void underflow(const char* what) const {
+        if constexpr (Check::enabled) {
+            stats_.on_underflow();
+            Check::underflow(what);
+        }
+    }
+
+    /**
+     * @brief Metodo privato che prepara l'header binario per gli elementi vivi
+     * 
+     * @param payload_size dimensione in byte del payload
+     * @param checksum hash del payload
+     * 
+     * @return StackBinaryHeader header da scrivere prima del payload
+    */
+    StackBinaryHeader binary_header(std::uint64_t payload_size, std::uint64_t checksum) const {
+        StackBinaryHeader h;
+        std::memcpy(h.magic, "STKB", 4);
+        h.version = STACK_BINARY_VERSION;
+        h.flags = std::is_trivially_copyable<T>::value ? STACK_BINARY_RAW : 0;
+        h.element_size = sizeof(T);
+        h.reserved = 0;
+        h.count = top_;
+        h.payload_size = payload_size;
+        h.checksum = checksum;
+        return h;
+    }
+
+    /**
+     * @brief Metodo privato che codifica gli elementi vivi (da fondo a cima) con Codec
+     * 
+     * @return std::string payload codificato
+    */
+    template <typename Codec>
+    std::string encode() const {
+        std::ostringstream os;
+        for (unsigned int i = 0; i < top_; ++i) {
+            Codec::write(os, stack_[i]);
+        }
+        return os.str();
+    }
+
+    /**
+     * @brief Metodo privato che verifica un header binario e prepara lo stack che riceverà gli elementi
+     * 
+     * L'header non è fidato: prima di allocare, la dimensione del payload viene confrontata con 
+     * i byte davvero disponibili e, per T trivially copyable, h.count con payload_size / sizeof(T).
+     * Per gli altri T la memoria per gli elementi viene allocata da decode() man mano che vengono 
+     * decodificati, mai in base al solo h.count.
+     * 
+     * @param h header letto
+     * @param available byte disponibili dopo l'header nello stream o nel buffer
+     * 
+     * @return Stack stack vuoto, con lo stesso allocatore e la stessa politica di crescita
+     * (per T trivially copyable già abbastanza grande per h.count elementi)
+     * 
+     * @throw std::runtime_error se l'header non è valido, non descrive uno stack di T 
+     * o promette più byte di quelli disponibili
+     * @throw std::length_error se gli elementi non entrano nello stack (e non è Geometric)
+    */
+    Stack binary_target(const StackBinaryHeader& h, std::uint64_t available) const {
+        if (std::memcmp(h.magic, "STKB", 4) != 0 || h.version != STACK_BINARY_VERSION)
+            throw std::runtime_error("Errore load(): formato binario non riconosciuto");
+        if (h.element_size != sizeof(T) ||
+            h.flags != (std::is_trivially_copyable<T>::value ? STACK_BINARY_RAW : 0))
+            throw std::runtime_error("Errore load(): il formato non descrive uno stack di questo tipo");
+        if (h.payload_size > available)
+            throw std::runtime_error("Errore load(): payload incompleto");
+        if (std::is_trivially_copyable<T>::value && 
+            (h.payload_size % sizeof(T) != 0 || h.count != h.payload_size / sizeof(T)))
+            throw std::runtime_error("Errore load(): dimensione del payload non valida");
+        if (h.count > UINT_MAX)
+            throw std::length_error("Errore load(): troppi elementi");
+        unsigned int n = static_cast<unsigned int>(h.count);
+        if (n > max_size_ && growth_ != StackGrowth::Geometric)
+            throw std::length_error("Errore load(): lo snapshot è più lungo dello stack");
+        if (std::is_trivially_copyable<T>::value && n > max_size_)
+            return Stack(n, growth_, alloc_);
+        return Stack(max_size_, growth_, alloc_);
+    }
+
+    /**
+     * @brief Metodo privato che ritorna i byte rimasti in uno stream posizionabile
+     * 
+     * @return std::uint64_t byte rimasti, UINT64_MAX se lo stream non è posizionabile
+    */
+    static std::uint64_t stream_available(std::istream& is) {
+        std::istream::pos_type pos = is.tellg();
+        if (pos == std::istream::pos_type(-1))
+            return UINT64_MAX;
+        is.seekg(0, std::ios::end);
+        std::istream::pos_type end = is.tellg();
+        is.seekg(pos);
+        if (end == std::istream::pos_type(-1) || !is)
+            return UINT64_MAX;
+        return static_cast<std::uint64_t>(end - pos);
+    }
+
+    /**
+     * @brief Metodo privato che legge size byte a blocchi: la memoria cresce con i byte davvero letti
+     * 
+     * @throw std::runtime_error se lo stream finisce prima
+    */
+    static std::string read_payload(std::istream& is, std::uint64_t size) {
+        const std::uint64_t BLOCK = 1 << 20;
+        std::string payload;
+        while (payload.size() < size) {
+            std::size_t chunk = static_cast<std::size_t>(std::min<std::uint64_t>(BLOCK, size - payload.size()));
+            std::size_t old = payload.size();
+            payload.resize(old + chunk);
+            if (!is.read(&payload[old], static_cast<std::streamsize>(chunk)))
+                throw std::runtime_error("Errore load(): payload incompleto");
+        }
+        return payload;
+    }
+
+    /**
+     * @brief Metodo privato che decodifica con Codec n elementi dal payload e li inserisce in cima
+     * 
+     * La capacità cresce solo con gli elementi decodificati (fino a n): un header che 
+     * dichiara più elementi di quelli presenti fallisce prima di allocare per tutti.
+     * 
+     * @param payload payload codificato
+     * @param n numero di elementi
+     * 
+     * @throw std::runtime_error se il payload finisce prima di n elementi
+    */
+    template <typename Codec>
+    void decode(std::string payload, unsigned int n) {
+        std::istringstream is(std::move(payload));
+        while (top_ < n) {
+            T value = Codec::read(is);
+            if (!is)
+                throw std::runtime_error("Errore load(): payload incompleto");
+            if (top_ == max_size_)
+                reallocate(max_size_ < 8 ? std::min(n, 8u) : (max_size_ > n / 2 ? n : max_size_ * 2));
+            construct(stack_ + top_, std::move(value));
+            ++top_;
+        }
+    }
+
+    /**
+     * @brief Metodo privato che sostituisce il contenuto con il payload in memoria descritto da h
+     * 
+     * Se il payload non è valido lo stack non viene modificato.
+     * 
+     * @param h header letto
+     * @param payload inizio dei byte che seguono l'header
+     * @param available numero di byte disponibili da payload in poi
+    */
+    template <typename Codec>
+    void install(const StackBinaryHeader& h, const unsigned char* payload, std::size_t available) {
+        Stack tmp = binary_target(h, available);
+        std::size_t bytes = static_cast<std::size_t>(h.payload_size);
+        if (stack_hash_bytes(payload, bytes) != h.checksum)
+            throw std::runtime_error("Errore load(): checksum non valido");
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (bytes > 0)
+                std::memcpy(static_cast<void*>(tmp.stack_), payload, bytes);
+            tmp.top_ = static_cast<unsigned int>(h.count);
+        }
+        else {
+            tmp.template decode<Codec>(std::string(reinterpret_cast<const char*>(payload), bytes),
+                                       static_cast<unsigned int>(h.count));
+        }
+        swap_storage(tmp);
+    }
 
 public:
 
     /**
      * @brief Costruttore di default
     */
-    Stack() : stack_(nullptr), max_size_(0), top_(0) {}
+    Stack() : stack_(nullptr), max_size_(0), top_(0), growth_(StackGrowth::Fixed), alloc_() {}
+
+    /**
+     * @brief Costruttore di default con allocatore
+     * 
+     * @param alloc allocatore da cui prendere la memoria dello stack
+    */
+    explicit Stack(const Alloc& alloc) : stack_(nullptr), max_size_(0), top_(0), growth_(StackGrowth::Fixed), alloc_(alloc) {}
 
     /**
      * @brief Costruttore di default che inizializza lo stack con la dimensione massima specificata
      * 
-     * @param max_size massima dimensione dello stack
+     * @param max_size massima dimensione dello stack (capacità iniziale se growth è Geometric)
+     * @param growth politica di crescita dello stack (di default Fixed)
+     * @param alloc allocatore da cui prendere la memoria dello stack
      * 
      * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
     */
-    Stack(unsigned int max_size) : max_size_(max_size), top_(0) {
-        try {
-            stack_ = new T[max_size_];
-        } catch (std::bad_alloc& e) {
-            std::cerr << "Error: " << e.what() << std::endl;
-            stack_ = nullptr;
-            throw;
-        }
+    Stack(unsigned int max_size, StackGrowth growth = StackGrowth::Fixed, const Alloc& alloc = Alloc()) 
+        : stack_(nullptr), max_size_(max_size), top_(0), growth_(growth), alloc_(alloc) {
+        stack_ = allocate(max_size_);
     }
     
     /**
@@ -38,83 +747,219 @@ public:
      * 
      * @param first iteratore all'inizio della sequenza di valori da inserire nello stack
      * @param last iteratore alla fine della sequenza di valori da inserire nello stack
+     * @param alloc allocatore da cui prendere la memoria dello stack
      * 
      * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
      */ 
     template <typename Iter>
-    Stack(Iter first, Iter last) : max_size_(last - first), top_(0) {
+    Stack(Iter first, Iter last, const Alloc& alloc = Alloc()) 
+        : stack_(nullptr), max_size_(last - first), top_(0), growth_(StackGrowth::Fixed), alloc_(alloc) {
         try {
-            stack_ = new T[max_size_];
-            for (; first != last && top_ < max_size_; ++first) {
-                stack_[top_++] = static_cast<T>(*first);
-            }
-        } catch (std::bad_alloc& e) {
-            std::cerr << "Error: " << e.what() << std::endl;
-            stack_ = nullptr;
+            stack_ = allocate(max_size_);
+            append(first, max_size_);
+        } catch (...) {
+            release();
             throw;
         }
     }
 
     /**
-     * @brief Costruttore di copia
+     * @brief Costruttore di copia (copia solo gli elementi vivi, non tutta la capacità)
+     * 
+     * @param other stack da copiare
+    */
+    Stack(const Stack& other) 
+        : Stack(other, alloc_traits::select_on_container_copy_construction(other.alloc_)) {}
+
+    /**
+     * @brief Costruttore di copia con allocatore
      * 
      * @param other stack da copiare
+     * @param alloc allocatore da cui prendere la memoria della copia
     */
-    Stack(const Stack& other) : max_size_(other.max_size_), top_(other.top_) {
+    Stack(const Stack& other, const Alloc& alloc) 
+        : stack_(nullptr), max_size_(other.max_size_), top_(0), growth_(other.growth_), alloc_(alloc), stats_(other.stats_) {
         try {
-            stack_ = new T[max_size_];
-            for (unsigned int i = 0; i < top_; ++i) {
-                stack_[i] = other.stack_[i];
-            }
-        } catch (std::bad_alloc& e) {
-            std::cerr << "Error: " << e.what() << std::endl;
-            stack_ = nullptr;
+            stack_ = allocate(max_size_);
+            copy_from(other);
+        } catch (...) {
+            release();
             throw;
         }
     }
 
+    /**
+     * @brief Costruttore di spostamento (O(1), nessuna copia degli elementi)
+     * 
+     * @param other stack da spostare (rimane vuoto con max_size 0)
+    */
+    Stack(Stack&& other) noexcept 
+        : stack_(other.stack_), max_size_(other.max_size_), top_(other.top_), growth_(other.growth_), alloc_(std::move(other.alloc_)) {
+        other.stack_ = nullptr;
+        other.max_size_ = 0;
+        other.top_ = 0;
+        other.marks_.lower(0);
+    }
+
+    /**
+     * @brief Costruttore di spostamento con allocatore
+     * 
+     * Se alloc è uguale all'allocatore di other il buffer viene rubato in O(1),
+     * altrimenti gli elementi vengono spostati uno ad uno nella memoria di alloc.
+     * 
+     * @param other stack da spostare
+     * @param alloc allocatore da cui prendere la memoria dello stack
+    */
+    Stack(Stack&& other, const Alloc& alloc) 
+        : stack_(nullptr), max_size_(0), top_(0), growth_(other.growth_), alloc_(alloc) {
+        if (alloc_ == other.alloc_) {
+            steal(other);
+        }
+        else {
+            max_size_ = other.max_size_;
+            try {
+                stack_ = allocate(max_size_);
+                move_from(other);
+            } catch (...) {
+                release();
+                throw;
+            }
+        }
+    }
+
     /**
      * @brief Distruttore
     */
     ~Stack() {
-        delete[] stack_;
-        stack_ = nullptr;
+        release();
     }
 
     /**
-     * @brief Operatore di assegnazione
+     * @brief Operatore di assegnazione (copy-and-swap)
+     * 
+     * La copia temporanea usa l'allocatore di destinazione (o quello di other se
+     * l'allocatore si propaga in assegnamento), poi viene scambiata con *this.
      * 
      * @param other stack da copiare
      * 
-     * @return Stack& riferimento allo stack copiato
+     * @return Stack& riferimento allo stack assegnato
     */
     Stack& operator=(const Stack& other) {
         if (this != &other) {
-            Stack tmp(other, other.max_size_, other.top_);
-            std::swap(stack_, tmp.stack_);
-            std::swap(max_size_, tmp.max_size_);
-            std::swap(top_, tmp.top_);
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+                Stack tmp(other, other.alloc_);
+                release();
+                alloc_ = other.alloc_;
+                swap_storage(tmp);
+            }
+            else {
+                Stack tmp(other, get_allocator());
+                swap_storage(tmp);
+            }
         }
         return *this;
     }
 
     /**
-     * @brief Operatore di confronto
+     * @brief Operatore di assegnazione di spostamento
+     * 
+     * O(1) se l'allocatore si propaga o è uguale a quello di other,
+     * altrimenti gli elementi vengono spostati nella memoria di *this.
+     * 
+     * @param other stack da spostare
+     * 
+     * @return Stack& riferimento allo stack assegnato
+    */
+    Stack& operator=(Stack&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                             alloc_traits::is_always_equal::value) {
+        if (this != &other) {
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+                release();
+                alloc_ = std::move(other.alloc_);
+                steal(other);
+            }
+            else if (alloc_ == other.alloc_) {
+                release();
+                steal(other);
+            }
+            else {
+                Stack tmp(std::move(other), get_allocator());
+                swap_storage(tmp);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Metodo per scambiare il contenuto di due stack in O(1)
+     * 
+     * Gli allocatori vengono scambiati solo se si propagano in swap, 
+     * altrimenti devono essere uguali.
+     * 
+     * @param other stack con cui scambiare il contenuto
+    */
+    void swap(Stack& other) noexcept {
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+            std::swap(alloc_, other.alloc_);
+        }
+        swap_storage(other);
+    }
+
+    /**
+     * @brief Metodo per ottenere l'allocatore dello stack
+     * 
+     * @return Alloc copia dell'allocatore
+    */
+    Alloc get_allocator() const {
+        return alloc_;
+    }
+
+    /**
+     * @brief Metodo per accedere ai contatori di strumentazione dello stack
+     * 
+     * I contatori appartengono all'oggetto: copie, spostamenti e swap non li trasferiscono.
+     * 
+     * @return Stats& politica di strumentazione (NoStackStats non ha contatori)
+    */
+    Stats& stats() const {
+        return stats_;
+    }
+
+    friend void swap(Stack& a, Stack& b) noexcept {
+        a.swap(b);
+    }
+
+    /**
+     * @brief Operatore di confronto (sul contenuto: la capacità non conta)
+     * 
+     * Per T con stack_bitwise_equal (interi, enum, puntatori, ...) il confronto è una 
+     * sola memcmp sul buffer contiguo, altrimenti usa operator== di T elemento per elemento.
      * 
      * @param other stack da confrontare
      * 
-     * @return true se gli stack sono uguali
+     * @return true se gli stack contengono gli stessi elementi nello stesso ordine
     */
     bool operator==(const Stack& other) const {
-        if (max_size_ != other.max_size_ || top_ != other.top_) {
+        if (top_ != other.top_) {
             return false;
         }
-        for (unsigned int i = 0; i < top_; ++i) {
-            if (stack_[i] != other.stack_[i]) {
-                return false;
-            }
+        if constexpr (stack_bitwise_equal<T>::value) {
+            return top_ == 0 || std::memcmp(stack_, other.stack_, top_ * sizeof(T)) == 0;
         }
-        return true;
+        else {
+            return std::equal(stack_, stack_ + top_, other.stack_);
+        }
+    }
+
+    /**
+     * @brief Operatore di diversità
+     * 
+     * @param other stack da confrontare
+     * 
+     * @return true se gli stack non contengono gli stessi elementi
+    */
+    bool operator!=(const Stack& other) const {
+        return !(*this == other);
     }
 
     /**
@@ -122,49 +967,244 @@ public:
      * 
      * @param value valore da inserire
      * 
-     * @throw std::length_error se lo stack è pieno e si prova ad inserire un elemento
+     * @throw std::length_error se lo stack è pieno (e non è Geometric) e si prova ad inserire un elemento
     */
     void push(const T& value) {
-        if (top_ < max_size_) {
-            stack_[top_++] = value;
+        if (top_ == max_size_) {
+            if (growth_ == StackGrowth::Geometric) {
+                // value potrebbe riferirsi ad un elemento dello stack stesso
+                T tmp(value);
+                grow();
+                construct(stack_ + top_, std::move(tmp));
+                ++top_;
+                stats_.on_push(1, top_);
+                return;
+            }
+            overflow("Stack overflow in push (top > max_size)");
+        }
+        construct(stack_ + top_, value);
+        ++top_;
+        stats_.on_push(1, top_);
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima allo stack spostandolo
+     * 
+     * @param value valore da spostare nello stack
+     * 
+     * @throw std::length_error se lo stack è pieno (e non è Geometric) e si prova ad inserire un elemento
+    */
+    void push(T&& value) {
+        if (top_ == max_size_) {
+            if (growth_ == StackGrowth::Geometric) {
+                // value potrebbe riferirsi ad un elemento dello stack stesso
+                T tmp(std::move(value));
+                grow();
+                construct(stack_ + top_, std::move(tmp));
+                ++top_;
+                stats_.on_push(1, top_);
+                return;
+            }
+            overflow("Stack overflow in push (top > max_size)");
+        }
+        construct(stack_ + top_, std::move(value));
+        ++top_;
+        stats_.on_push(1, top_);
+    }
+
+    /**
+     * @brief Metodo per costruire un elemento in cima allo stack a partire dagli argomenti
+     * 
+     * @param args argomenti passati al costruttore di T
+     * 
+     * @return T& riferimento all'elemento inserito
+     * 
+     * @throw std::length_error se lo stack è pieno (e non è Geometric) e si prova ad inserire un elemento
+    */
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        if (top_ == max_size_ && growth_ == StackGrowth::Geometric) {
+            // gli argomenti potrebbero riferirsi ad elementi dello stack stesso
+            T tmp(std::forward<Args>(args)...);
+            grow();
+            construct(stack_ + top_, std::move(tmp));
         }
         else {
-            throw std::length_error("Stack overflow in push (top > max_size)");
+            if (top_ == max_size_)
+                overflow("Stack overflow in emplace (top > max_size)");
+            construct(stack_ + top_, std::forward<Args>(args)...);
         }
+        ++top_;
+        stats_.on_push(1, top_);
+        return stack_[top_ - 1];
     }
 
     /**
      * @brief Metodo per rimuovere un elemento in cima allo stack e restituirlo
      * 
+     * La cella liberata viene distrutta, quindi l'elemento è restituito per valore.
+     * 
      * @throw std::length_error se lo stack è vuoto e si prova a rimuovere un elemento
      * 
-     * @return T& riferimento all'elemento rimosso
+     * @return T elemento rimosso
     */
-    T& pop() {
-        if (top_ > 0)
-            return stack_[--top_];
-        else
-            throw std::length_error("Stack underflow in pop (top < 0)");
+    T pop() {
+        if (Check::enabled && top_ == 0)
+            underflow("Stack underflow in pop (top < 0)");
+        return pop_unchecked();
+    }
+
+    /**
+     * @brief Metodo per rimuovere un elemento in cima allo stack e restituirlo per valore
+     * 
+     * Sinonimo di pop(): l'elemento viene spostato fuori dallo stack, senza copie.
+     * 
+     * @throw std::length_error se lo stack è vuoto e si prova a rimuovere un elemento
+     * 
+     * @return T elemento rimosso
+    */
+    T pop_value() {
+        return pop();
     }
 
     /**
      * @brief Metodo per ottenere l'elemento in cima allo stack
      * 
-     * @return T& riferimento all'elemento in cima allo stack
+     * @return T& riferimento all'elemento in cima allo stack
+    */
+    T& top() const {
+        stats_.on_top();
+        if (Check::enabled && top_ == 0)
+            underflow("Stack underflow in top (top < 0)");
+        return stack_[top_ - 1];
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento senza alcun controllo (precondizione: !full())
+     * 
+     * @param value valore da inserire
+    */
+    void push_unchecked(const T& value) {
+        construct(stack_ + top_, value);
+        ++top_;
+        stats_.on_push(1, top_);
+    }
+
+    void push_unchecked(T&& value) {
+        construct(stack_ + top_, std::move(value));
+        ++top_;
+        stats_.on_push(1, top_);
+    }
+
+    /**
+     * @brief Metodo per rimuovere l'elemento in cima senza alcun controllo (precondizione: !empty())
+     * 
+     * @return T elemento rimosso
+    */
+    T pop_unchecked() {
+        T value(std::move(stack_[top_ - 1]));
+        --top_;
+        destroy(stack_ + top_, stack_ + top_ + 1);
+        marks_.lower(top_);
+        stats_.on_pop(1);
+        return value;
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento solo se c'è posto (nessuna eccezione di overflow)
+     * 
+     * Uno stack Geometric cresce come con push(); solo la memoria esaurita lancia ancora std::bad_alloc.
+     * 
+     * @param value valore da inserire
+     * 
+     * @return true se l'elemento è stato inserito, false se lo stack è pieno
+    */
+    bool try_push(const T& value) {
+        if (top_ == max_size_ && (growth_ != StackGrowth::Geometric || max_size_ == UINT_MAX))
+            return false;
+        push(value);
+        return true;
+    }
+
+    bool try_push(T&& value) {
+        if (top_ == max_size_ && (growth_ != StackGrowth::Geometric || max_size_ == UINT_MAX))
+            return false;
+        push(std::move(value));
+        return true;
+    }
+
+    /**
+     * @brief Metodo per rimuovere l'elemento in cima se c'è (nessuna eccezione di underflow)
+     * 
+     * @return std::optional<T> elemento rimosso (vuoto se lo stack è vuoto)
+    */
+    std::optional<T> try_pop() {
+        if (top_ == 0)
+            return std::nullopt;
+        return pop_unchecked();
+    }
+
+    /**
+     * @brief Metodo per rimuovere l'elemento in cima se c'è, spostandolo in out
+     * 
+     * @param out destinazione dell'elemento rimosso
+     * 
+     * @return true se un elemento è stato rimosso
+    */
+    bool try_pop(T& out) {
+        if (top_ == 0)
+            return false;
+        out = pop_unchecked();
+        return true;
+    }
+
+    /**
+     * @brief Metodo per cancellare tutti gli elementi dello stack (vengono distrutti, la capacità resta)
+     * 
+    */
+    void clear() {
+        destroy(stack_, stack_ + top_);
+        top_ = 0;
+        marks_.lower(0);
+    }
+
+    /**
+     * @brief Metodo per prendere un punto di salvataggio (O(1), nessuna copia)
+     * 
+     * Sostituisce la copia dell'intero stack prima di un ramo speculativo: in caso di 
+     * fallimento rollback_to() toglie solo gli elementi inseriti dopo il mark.
+     * In debug (NDEBUG non definita) il mark viene anche registrato per riconoscerlo se scade.
+     * 
+     * @return StackMark punto di salvataggio
+     * 
+     * @throw std::bad_alloc solo in debug, se non è possibile allocare lo spazio per il registro
     */
-    T& top() const {
-        if (top_ > 0)
-            return stack_[top_ - 1];
-        else
-            throw std::length_error("Stack underflow in top (top < 0)");
+    StackMark mark() const {
+        return StackMark{top_, marks_.take(top_)};
     }
 
     /**
-     * @brief Metodo per cancellare tutti gli elementi dello stack (logicamente)
+     * @brief Metodo per tornare a un punto di salvataggio distruggendo gli elementi inseriti dopo
+     * 
+     * Costa O(elementi rimossi) e non cambia la capacità. Il mark resta valido, quindi si 
+     * può tornare allo stesso punto più volte (un ramo dopo l'altro); i mark presi dopo
+     * di esso non lo sono più. Con la politica di controllo attiva un mark più alto della 
+     * cima (lo stack è già sceso sotto il mark) viene segnalato come underflow; in debug
+     * anche un mark scaduto e poi superato di nuovo dallo stack, che altrimenti 
+     * distruggerebbe elementi inseriti dopo la discesa.
      * 
+     * @param m punto di salvataggio restituito da mark()
+     * 
+     * @throw std::length_error se il mark non è valido (con StackCheckThrow)
     */
-    void clear() {
-        top_ = 0;
+    void rollback_to(StackMark m) {
+        if (Check::enabled && (m.size > top_ || !marks_.valid(m)))
+            underflow("Stack underflow in rollback_to (stale mark)");
+        unsigned int n = top_ - m.size;
+        destroy(stack_ + m.size, stack_ + top_);
+        top_ = m.size;
+        marks_.lower(top_);
+        stats_.on_pop(n);
     }
 
     /**
@@ -194,15 +1234,50 @@ public:
         return top_;
     }
 
-        /**
+    /**
      * @brief Metodo per ottenere la dimensione massima dello stack
      * 
-     * @return unsigned int dimensione massima dello stack
+     * @return unsigned int dimensione massima dello stack (capacità attuale se growth è Geometric)
     */
     unsigned int max_size() const {
         return max_size_;
     }
 
+    /**
+     * @brief Metodo per ottenere la politica di crescita dello stack
+     * 
+     * @return StackGrowth politica di crescita dello stack
+    */
+    StackGrowth growth() const {
+        return growth_;
+    }
+
+    /**
+     * @brief Metodo per riservare spazio per almeno new_size elementi
+     * 
+     * Non riduce mai la capacità. Su uno stack Fixed alza il limite massimo.
+     * 
+     * @param new_size capacità minima richiesta
+     * 
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    void reserve(unsigned int new_size) {
+        if (new_size > max_size_)
+            reallocate(new_size);
+    }
+
+    /**
+     * @brief Metodo per ridurre la capacità dello stack al numero di elementi presenti
+     * 
+     * Su uno stack Fixed abbassa il limite massimo a size().
+     * 
+     * @throw std::bad_alloc se non è possibile allocare lo spazio necessario per lo stack
+    */
+    void shrink_to_fit() {
+        if (top_ < max_size_)
+            reallocate(top_);
+    }
+
     /**
      * @brief Metodo per stampare lo stack (da fondo a cima - sinistra a destra)
      * 
@@ -221,33 +1296,223 @@ public:
                 os << s.stack_[i] << " ";
             }
         }
-        os << "]" << std::endl;
+        os << "]" << '\n';
         return os;
     }
 
+    /**
+     * @brief Metodo per salvare lo stack in formato binario (header + elementi da fondo a cima)
+     * 
+     * Per T trivially copyable gli elementi sono scritti con una sola write del buffer;
+     * per gli altri tipi ogni elemento passa da Codec::write.
+     * 
+     * @param os stream di output (aperto in modalità binaria)
+     * 
+     * @throw std::runtime_error se la scrittura fallisce
+    */
+    template <typename Codec = StackCodec<T>>
+    void save(std::ostream& os) const {
+        StackBinaryHeader h;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::size_t bytes = static_cast<std::size_t>(top_) * sizeof(T);
+            h = binary_header(bytes, stack_hash_bytes(stack_, bytes));
+            os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+            os.write(reinterpret_cast<const char*>(stack_), static_cast<std::streamsize>(bytes));
+        }
+        else {
+            std::string payload = encode<Codec>();
+            h = binary_header(payload.size(), stack_hash_bytes(payload.data(), payload.size()));
+            os.write(reinterpret_cast<const char*>(&h), sizeof(h));
+            os.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        }
+        if (!os)
+            throw std::runtime_error("Errore save(): scrittura fallita");
+    }
+
+    /**
+     * @brief Metodo per sostituire il contenuto dello stack con uno snapshot scritto da save()
+     * 
+     * Per T trivially copyable e stream posizionabili gli elementi sono letti con una sola 
+     * read direttamente nel nuovo buffer, dopo aver verificato che lo stream contenga tutto
+     * il payload dichiarato. Negli altri casi il payload viene letto a blocchi prima di 
+     * allocare lo stack. Se lo snapshot non è valido lo stack non viene modificato.
+     * 
+     * @param is stream di input (aperto in modalità binaria)
+     * 
+     * @throw std::runtime_error se lo snapshot è incompleto, corrotto o di un altro tipo
+     * @throw std::length_error se lo snapshot non entra nello stack (e non è Geometric)
+    */
+    template <typename Codec = StackCodec<T>>
+    void load(std::istream& is) {
+        StackBinaryHeader h;
+        if (!is.read(reinterpret_cast<char*>(&h), sizeof(h)))
+            throw std::runtime_error("Errore load(): header incompleto");
+        std::uint64_t available = stream_available(is);
+        if (std::is_trivially_copyable<T>::value && available != UINT64_MAX) {
+            Stack tmp = binary_target(h, available);
+            std::size_t bytes = static_cast<std::size_t>(h.payload_size);
+            if (!is.read(reinterpret_cast<char*>(tmp.stack_), static_cast<std::streamsize>(bytes)))
+                throw std::runtime_error("Errore load(): payload incompleto");
+            if (stack_hash_bytes(tmp.stack_, bytes) != h.checksum)
+                throw std::runtime_error("Errore load(): checksum non valido");
+            tmp.top_ = static_cast<unsigned int>(h.count);
+            swap_storage(tmp);
+        }
+        else {
+            // stream non posizionabile o T codificato: il payload viene letto a blocchi
+            // prima di allocare lo stack, poi installato come da un buffer
+            if (h.payload_size > available)
+                throw std::runtime_error("Errore load(): payload incompleto");
+            std::string payload = read_payload(is, h.payload_size);
+            install<Codec>(h, reinterpret_cast<const unsigned char*>(payload.data()), payload.size());
+        }
+    }
+
+    /**
+     * @brief Metodo per serializzare lo stack in un buffer di byte (stesso formato di save())
+     * 
+     * @return std::vector<unsigned char> header seguito dal payload
+    */
+    template <typename Codec = StackCodec<T>>
+    std::vector<unsigned char> serialize() const {
+        std::vector<unsigned char> out;
+        StackBinaryHeader h;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            std::size_t bytes = static_cast<std::size_t>(top_) * sizeof(T);
+            h = binary_header(bytes, stack_hash_bytes(stack_, bytes));
+            out.resize(sizeof(h) + bytes);
+            if (bytes > 0)
+                std::memcpy(out.data() + sizeof(h), stack_, bytes);
+        }
+        else {
+            std::string payload = encode<Codec>();
+            h = binary_header(payload.size(), stack_hash_bytes(payload.data(), payload.size()));
+            out.resize(sizeof(h) + payload.size());
+            std::memcpy(out.data() + sizeof(h), payload.data(), payload.size());
+        }
+        std::memcpy(out.data(), &h, sizeof(h));
+        return out;
+    }
+
+    /**
+     * @brief Metodo per sostituire il contenuto dello stack con un buffer prodotto da serialize()
+     * 
+     * Se il buffer non è valido lo stack non viene modificato.
+     * 
+     * @param data inizio del buffer
+     * @param len lunghezza del buffer in byte
+     * 
+     * @throw std::runtime_error se il buffer è incompleto, corrotto o di un altro tipo
+     * @throw std::length_error se lo snapshot non entra nello stack (e non è Geometric)
+    */
+    template <typename Codec = StackCodec<T>>
+    void deserialize(const void* data, std::size_t len) {
+        StackBinaryHeader h;
+        if (len < sizeof(h))
+            throw std::runtime_error("Errore deserialize(): header incompleto");
+        std::memcpy(&h, data, sizeof(h));
+        install<Codec>(h, static_cast<const unsigned char*>(data) + sizeof(h), len - sizeof(h));
+    }
+
+    /**
+     * @brief Overload di deserialize() per un buffer prodotto da serialize()
+    */
+    template <typename Codec = StackCodec<T>>
+    void deserialize(const std::vector<unsigned char>& buffer) {
+        deserialize<Codec>(buffer.data(), buffer.size());
+    }
+
     /**
      * @brief Metodo pubblico per riempire lo stack con una nuova sequenza di elementi (sovrascrizione permessa)
      * 
      * @param first iteratore all'inizio della sequenza
      * @param last iteratore alla fine della sequenza
      * 
-     * @throw std::length_error se la sequenza di elementi è più lunga di quella dello stack
+     * @throw std::length_error se la sequenza di elementi è più lunga di quella dello stack (e non è Geometric)
     */
     template <typename Iter>
     void fill(Iter first, Iter last) {
-        try {
-            if ((last - first) > max_size_)
+        if ((last - first) > max_size_) {
+            if (growth_ != StackGrowth::Geometric) {
+                stats_.on_overflow();
                 throw std::length_error("Errore fill(): la sequenza di elementi è più lunga di quella dello stack");
-            
+            }
             clear();
-            
-            for (; first != last && top_ < max_size_; ++first) {
-                stack_[top_++] = static_cast<T>(*first);
+            reserve(last - first);
+        }
+        
+        clear();
+        
+        append(first, static_cast<unsigned int>(last - first));
+    }
+
+    /**
+     * @brief Metodo per inserire in cima una sequenza di elementi (il primo finisce più in basso)
+     * 
+     * La capacità viene controllata una sola volta per tutta la sequenza. Per sequenze contigue
+     * di T trivially copyable l'inserimento è una sola memcpy. La sequenza non deve
+     * appartenere allo stack stesso.
+     * 
+     * @param first iteratore all'inizio della sequenza
+     * @param last iteratore alla fine della sequenza
+     * 
+     * @throw std::length_error se la sequenza non entra nello stack (e non è Geometric)
+    */
+    template <typename Iter>
+    void push_range(Iter first, Iter last) {
+        typedef typename std::iterator_traits<Iter>::iterator_category category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+            typename std::iterator_traits<Iter>::difference_type n = std::distance(first, last);
+            if (n < 0 || static_cast<unsigned long long>(n) > UINT_MAX)
+                throw std::length_error("Stack overflow in push_range (sequenza troppo lunga)");
+            ensure_room(static_cast<unsigned int>(n), "Stack overflow in push_range (top + n > max_size)");
+            append(first, static_cast<unsigned int>(n));
+            stats_.on_push(static_cast<unsigned int>(n), top_);
+        }
+        else {
+            // iteratori di input: la lunghezza non è nota in anticipo
+            for (; first != last; ++first) {
+                push(*first);
+            }
+        }
+    }
+
+    /**
+     * @brief Metodo per rimuovere gli n elementi in cima e scriverli in out
+     * 
+     * Gli elementi vengono scritti dal più in basso a quello in cima, cioè nello stesso
+     * ordine in cui push_range() li reinserirebbe. Per output contigui di T trivially 
+     * copyable la copia è una sola memcpy.
+     * 
+     * @param n numero di elementi da rimuovere
+     * @param out iteratore di output
+     * 
+     * @return OutIter iteratore di output dopo l'ultimo elemento scritto
+     * 
+     * @throw std::length_error se lo stack contiene meno di n elementi
+    */
+    template <typename OutIter>
+    OutIter pop_n(unsigned int n, OutIter out) {
+        if (Check::enabled && n > top_)
+            underflow("Stack underflow in pop_n (n > top)");
+        T* first = stack_ + (top_ - n);
+        typedef typename std::remove_cv<typename std::iterator_traits<OutIter>::value_type>::type value_type;
+        if constexpr (is_contiguous_iterator<OutIter>::value && std::is_same<value_type, T>::value &&
+                      std::is_trivially_copyable<T>::value) {
+            if (n > 0)
+                std::memcpy(static_cast<void*>(std::addressof(*out)), first, n * sizeof(T));
+            out += n;
+        }
+        else {
+            for (T* p = first; p != stack_ + top_; ++p, ++out) {
+                *out = std::move(*p);
             }
-        } catch (std::bad_alloc& e) {
-            std::cerr << "Error: " << e.what() << std::endl;
-            throw;
         }
+        destroy(first, stack_ + top_);
+        top_ -= n;
+        marks_.lower(top_);
+        stats_.on_pop(n);
+        return out;
     }
 
     /**
@@ -274,27 +1539,30 @@ public:
 	class const_iterator; // forward declaration
 
     /**
-     * @brief Classe per l'iteratore dello stack (forward iterator)
+     * @brief Classe per l'iteratore dello stack (random access, elementi contigui)
     */
 	class iterator {
 
 	public:
-		typedef std::forward_iterator_tag iterator_category;
-		typedef T                         value_type;
-		typedef ptrdiff_t                 difference_type;
-		typedef T*                        pointer;
-		typedef T&                        reference;
+		typedef std::random_access_iterator_tag iterator_category;
+#if __cplusplus >= 202002L
+		typedef std::contiguous_iterator_tag    iterator_concept;
+#endif
+		typedef T                               value_type;
+		typedef ptrdiff_t                       difference_type;
+		typedef T*                              pointer;
+		typedef T&                              reference;
+
+		// Marcatore letto da is_contiguous_iterator
+		typedef std::true_type                  is_contiguous;
 
 	
-		iterator() : stack_(nullptr), top_(0) {}
+		iterator() : stack_(nullptr) {}
 		
-		iterator(const iterator &other) : stack_(other.stack_), top_(other.top_) {}
+		iterator(const iterator &other) : stack_(other.stack_) {}
 
 		iterator& operator=(const iterator &other) {
-            if (this != &other) {
-                stack_ = other.stack_;
-                top_ = other.top_;
-            }
+            stack_ = other.stack_;
             return *this;
         }
 
@@ -307,22 +1575,67 @@ public:
         
 		// Ritorna il puntatore al dato riferito dall'iteratore
 		pointer operator->() const {
-            return &stack_;
+            return stack_;
+		}
+
+		// Ritorna il dato a distanza n dall'iteratore
+		reference operator[](difference_type n) const {
+            return stack_[n];
 		}
 
 		// Operatore di iterazione post-incremento
 		iterator operator++(int) {
-            iterator tmp(stack_, top_);
-            stack_ = stack_ + 1;
+            iterator tmp(*this);
+            ++stack_;
             return tmp;
 		}
 
 		// Operatore di iterazione pre-incremento
 		iterator& operator++() {
-            stack_ = stack_ + 1;
+            ++stack_;
+            return *this;
+		}
+
+		// Operatore di iterazione post-decremento
+		iterator operator--(int) {
+            iterator tmp(*this);
+            --stack_;
+            return tmp;
+		}
+
+		// Operatore di iterazione pre-decremento
+		iterator& operator--() {
+            --stack_;
+            return *this;
+		}
+
+		// Aritmetica degli iteratori
+		iterator& operator+=(difference_type n) {
+            stack_ += n;
+            return *this;
+		}
+
+		iterator& operator-=(difference_type n) {
+            stack_ -= n;
             return *this;
 		}
 
+		iterator operator+(difference_type n) const {
+            return iterator(stack_ + n);
+		}
+
+		friend iterator operator+(difference_type n, const iterator &it) {
+            return iterator(it.stack_ + n);
+		}
+
+		iterator operator-(difference_type n) const {
+            return iterator(stack_ - n);
+		}
+
+		difference_type operator-(const iterator &other) const {
+            return stack_ - other.stack_;
+		}
+
 		// Uguaglianza
 		bool operator==(const iterator &other) const {
             return (stack_ == other.stack_);
@@ -332,6 +1645,23 @@ public:
 		bool operator!=(const iterator &other) const {
             return (stack_ != other.stack_);
 		}
+
+		// Ordinamento
+		bool operator<(const iterator &other) const {
+            return stack_ < other.stack_;
+		}
+
+		bool operator>(const iterator &other) const {
+            return stack_ > other.stack_;
+		}
+
+		bool operator<=(const iterator &other) const {
+            return stack_ <= other.stack_;
+		}
+
+		bool operator>=(const iterator &other) const {
+            return stack_ >= other.stack_;
+		}
 		
 		// Solo se serve anche const_iterator aggiungere le seguenti definizioni
 		friend class const_iterator;
@@ -354,44 +1684,45 @@ public:
 
 		// Costruttore privato di inizializzazione usato dalla classe container
 		// tipicamente nei metodi begin e end
-		iterator(T *s, unsigned int t) : stack_(s), top_(t) {}
+		explicit iterator(T *s) : stack_(s) {}
 
         T *stack_;
-
-        unsigned int top_;
 		
 	}; // fine classe iterator
 	
 	// Ritorna l'iteratore all'inizio della sequenza dati
 	iterator begin() {
-		return iterator(stack_, 0);
+		return iterator(stack_);
 	}
 	
 	// Ritorna l'iteratore alla fine della sequenza dati
 	iterator end() {
-		return iterator(stack_ + top_, top_);
+		return iterator(stack_ + top_);
 	}
 	
 	
 	class const_iterator {
 
 	public:
-		typedef std::forward_iterator_tag iterator_category;
-		typedef T                         value_type;
-		typedef ptrdiff_t                 difference_type;
-		typedef const T*                  pointer;
-		typedef const T&                  reference;
+		typedef std::random_access_iterator_tag iterator_category;
+#if __cplusplus >= 202002L
+		typedef std::contiguous_iterator_tag    iterator_concept;
+#endif
+		typedef T                               value_type;
+		typedef ptrdiff_t                       difference_type;
+		typedef const T*                        pointer;
+		typedef const T&                        reference;
+
+		// Marcatore letto da is_contiguous_iterator
+		typedef std::true_type                  is_contiguous;
 
 	
-		const_iterator() : stack_(nullptr), top_(0) {}
+		const_iterator() : stack_(nullptr) {}
 		
-		const_iterator(const const_iterator &other) : stack_(other.stack_), top_(other.top_) {}
+		const_iterator(const const_iterator &other) : stack_(other.stack_) {}
 
 		const_iterator& operator=(const const_iterator &other) {
-            if (this != &other) {
-                stack_ = other.stack_;
-                top_ = other.top_;
-            }
+            stack_ = other.stack_;
             return *this;
 		}
 
@@ -404,22 +1735,67 @@ public:
 
 		// Ritorna il puntatore al dato riferito dall'iteratore
 		pointer operator->() const {
-            return &stack_;
+            return stack_;
+		}
+
+		// Ritorna il dato a distanza n dall'iteratore
+		reference operator[](difference_type n) const {
+            return stack_[n];
 		}
 		
 		// Operatore di iterazione post-incremento
 		const_iterator operator++(int) {
-            const_iterator tmp(*this, top_);
-            stack_ = stack_ + 1;
+            const_iterator tmp(*this);
+            ++stack_;
             return tmp;
 		}
 
 		// Operatore di iterazione pre-incremento
 		const_iterator& operator++() {
-            stack_ = stack_ + 1;
+            ++stack_;
+            return *this;
+		}
+
+		// Operatore di iterazione post-decremento
+		const_iterator operator--(int) {
+            const_iterator tmp(*this);
+            --stack_;
+            return tmp;
+		}
+
+		// Operatore di iterazione pre-decremento
+		const_iterator& operator--() {
+            --stack_;
+            return *this;
+		}
+
+		// Aritmetica degli iteratori
+		const_iterator& operator+=(difference_type n) {
+            stack_ += n;
+            return *this;
+		}
+
+		const_iterator& operator-=(difference_type n) {
+            stack_ -= n;
             return *this;
 		}
 
+		const_iterator operator+(difference_type n) const {
+            return const_iterator(stack_ + n);
+		}
+
+		friend const_iterator operator+(difference_type n, const const_iterator &it) {
+            return const_iterator(it.stack_ + n);
+		}
+
+		const_iterator operator-(difference_type n) const {
+            return const_iterator(stack_ - n);
+		}
+
+		difference_type operator-(const const_iterator &other) const {
+            return stack_ - other.stack_;
+		}
+
 		// Uguaglianza
 		bool operator==(const const_iterator &other) const {
             return (stack_ == other.stack_);
@@ -430,6 +1806,23 @@ public:
             return (stack_ != other.stack_);
 		}
 
+		// Ordinamento
+		bool operator<(const const_iterator &other) const {
+            return stack_ < other.stack_;
+		}
+
+		bool operator>(const const_iterator &other) const {
+            return stack_ > other.stack_;
+		}
+
+		bool operator<=(const const_iterator &other) const {
+            return stack_ <= other.stack_;
+		}
+
+		bool operator>=(const const_iterator &other) const {
+            return stack_ >= other.stack_;
+		}
+
 		// Solo se serve anche iterator aggiungere le seguenti definizioni
 		
 		friend class iterator;
@@ -445,14 +1838,11 @@ public:
 		}
 
 		// Costruttore di conversione iterator -> const_iterator
-		const_iterator(const iterator &other) : stack_(other.stack_), top_(other.top_) {}
+		const_iterator(const iterator &other) : stack_(other.stack_) {}
 
 		// Assegnamento di un iterator ad un const_iterator
 		const_iterator &operator=(const iterator &other) {
-            if (this != &other) {
-                stack_ = other.stack_;
-                top_ = other.top_;
-            }
+            stack_ = other.stack_;
             return *this;
 		}
 
@@ -464,93 +1854,230 @@ public:
 
 		// Costruttore privato di inizializzazione usato dalla classe container
 		// tipicamente nei metodi begin e end
-		const_iterator(const T *s, unsigned int t) : stack_(s), top_(t) {}
+		explicit const_iterator(const T *s) : stack_(s) {}
 
         const T *stack_;
-
-        unsigned int top_;
 		
 	}; // fine classe const_iterator
 	
 	// Ritorna l'iteratore all'inizio della sequenza dati
 	const_iterator begin() const {
-		return const_iterator(stack_, 0);
+		return const_iterator(stack_);
 	}
 	
 	// Ritorna l'iteratore alla fine della sequenza dati
 	const_iterator end() const {
-		return const_iterator(stack_ + top_, top_);
+		return const_iterator(stack_ + top_);
 	}
 
-// ---------------------- FINE ITERATORI ----------------------
+	const_iterator cbegin() const {
+		return begin();
+	}
 
-// ---------------------- INIZIO ITERATORE CUSTOM ----------------------
+	const_iterator cend() const {
+		return end();
+	}
+
+	// Iteratori inversi (da cima a fondo)
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	reverse_iterator rbegin() {
+		return reverse_iterator(end());
+	}
+
+	reverse_iterator rend() {
+		return reverse_iterator(begin());
+	}
+
+	const_reverse_iterator rbegin() const {
+		return const_reverse_iterator(end());
+	}
+
+	const_reverse_iterator rend() const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_reverse_iterator crbegin() const {
+		return rbegin();
+	}
+
+	const_reverse_iterator crend() const {
+		return rend();
+	}
 
     /**
-     * @brief Classe Iteratore Custom di sola lettura per lo stack (forward iterator)
+     * @brief Metodo per accedere direttamente al buffer contiguo degli elementi
+     * 
+     * @return T* puntatore all'elemento in fondo allo stack ([data(), data() + size()) sono gli elementi vivi)
     */
-    class readOnlyIterator {
+    T* data() {
+        return stack_;
+    }
 
-    public:
+    const T* data() const {
+        return stack_;
+    }
 
-        readOnlyIterator() : stack_(nullptr), top_(0) {}
+    /**
+     * @brief Metodo per leggere gli n elementi in cima senza rimuoverli
+     * 
+     * @param n numero di elementi
+     * 
+     * @return const_iterator iteratore al più in basso degli n elementi: [top_n(n), end())
+     * 
+     * @throw std::length_error se lo stack contiene meno di n elementi
+    */
+    const_iterator top_n(unsigned int n) const {
+        if (Check::enabled && n > top_)
+            underflow("Stack underflow in top_n (n > top)");
+        return const_iterator(stack_ + (top_ - n));
+    }
 
-        readOnlyIterator(const readOnlyIterator &other) : stack_(other.stack_), top_(other.top_) {}
+// ---------------------- FINE ITERATORI ----------------------
 
-        T& operator*() const {
-            // return stack_[top_];
-            return *stack_;
-        }
+// ---------------------- INIZIO ITERATORE CUSTOM ----------------------
 
-        T* operator->() const {
-            // return &stack_[top_];
-            return &stack_;
-        }
+    /**
+     * @brief Iteratore Custom di sola lettura per lo stack (da cima a fondo)
+     * 
+     * È un iteratore inverso sul buffer: non costruisce mai puntatori prima 
+     * dell'inizio del buffer.
+    */
+    typedef const_reverse_iterator readOnlyIterator;
 
-        readOnlyIterator& operator++() {
-            // --top_;
-            stack_ = stack_ - 1;
-            return *this;
-        }
+    readOnlyIterator readOnlyBegin() const {
+        return rbegin();
+    }
 
-        readOnlyIterator operator++(int) {
-            readOnlyIterator tmp(stack_, top_);
-            operator++();
-            return tmp;
-        }
+    readOnlyIterator readOnlyEnd() const {
+        return rend();
+    }
 
-        bool operator==(const readOnlyIterator& other) const {
-            // return stack_ == other.stack_ && top_ == other.top_;
-            return stack_ == other.stack_;
-        }
-        
-        bool operator!=(const readOnlyIterator& other) const {
-            // return stack_ != other.stack_ || top_ != other.top_;
-            return stack_ != other.stack_;
-        }
+// ---------------------- FINE ITERATORE CUSTOM ----------------------
 
-    private:
+// ---------------------- INTERROGAZIONI SU TUTTO LO STACK ----------------------
 
-        friend class Stack;
+    /**
+     * @brief Numero minimo di elementi oltre il quale le interrogazioni su tutto lo stack
+     * usano l'esecuzione parallela (solo con STACK_PARALLEL definita)
+    */
+    static constexpr unsigned int parallel_threshold = 1u << 16;
 
-        readOnlyIterator(T *s, unsigned int t) : stack_(s), top_(t) {}
+    /**
+     * @brief Metodo pubblico che conta gli elementi dello stack che soddisfano il predicato P
+     * 
+     * Sopra parallel_threshold elementi (con STACK_PARALLEL) la scansione è parallela: 
+     * il predicato non deve avere effetti collaterali.
+     * 
+     * @param predicate predicato generico (come per checkif)
+     * 
+     * @return unsigned int numero di elementi che soddisfano P
+    */
+    template <typename P>
+    unsigned int count_if(const P& predicate) const {
+        return static_cast<unsigned int>(STACK_PAR_ALGO(count_if, top_, begin(), end(), predicate));
+    }
 
-        T* stack_;
+    /**
+     * @brief Metodo pubblico che ritorna true se almeno un elemento soddisfa il predicato P
+     * 
+     * @param predicate predicato generico (come per checkif)
+     * 
+     * @return true se almeno un elemento soddisfa P (false se lo stack è vuoto)
+    */
+    template <typename P>
+    bool any_of(const P& predicate) const {
+        return STACK_PAR_ALGO(any_of, top_, begin(), end(), predicate);
+    }
 
-        unsigned int top_;
+    /**
+     * @brief Metodo pubblico che ritorna true se tutti gli elementi soddisfano il predicato P
+     * 
+     * @param predicate predicato generico (come per checkif)
+     * 
+     * @return true se tutti gli elementi soddisfano P (true se lo stack è vuoto)
+    */
+    template <typename P>
+    bool all_of(const P& predicate) const {
+        return STACK_PAR_ALGO(all_of, top_, begin(), end(), predicate);
+    }
 
-    };
+    /**
+     * @brief Metodo pubblico che cerca il primo elemento che soddisfa P partendo dal fondo
+     * 
+     * @param predicate predicato generico (come per checkif)
+     * 
+     * @return const_iterator elemento trovato più vicino al fondo (end() se nessuno)
+    */
+    template <typename P>
+    const_iterator find_if(const P& predicate) const {
+        return STACK_PAR_ALGO(find_if, top_, begin(), end(), predicate);
+    }
 
-    readOnlyIterator readOnlyBegin() const {
-        return readOnlyIterator(stack_ + top_ - 1, top_ - 1);
+    /**
+     * @brief Metodo pubblico che cerca il primo elemento che soddisfa P partendo dalla cima
+     * 
+     * @param predicate predicato generico (come per checkif)
+     * 
+     * @return const_reverse_iterator elemento trovato più vicino alla cima (rend() se nessuno)
+    */
+    template <typename P>
+    const_reverse_iterator rfind_if(const P& predicate) const {
+        return STACK_PAR_ALGO(find_if, top_, rbegin(), rend(), predicate);
     }
 
-    readOnlyIterator readOnlyEnd() const {
-        return readOnlyIterator(stack_ - 1, 0);
+    /**
+     * @brief Metodo pubblico che, per uno stack partizionato rispetto a P (dal fondo prima 
+     * tutti gli elementi che soddisfano P, poi quelli che non lo soddisfano), trova il 
+     * primo elemento che non soddisfa P con una ricerca binaria
+     * 
+     * @param predicate predicato generico (come per checkif)
+     * 
+     * @return const_iterator primo elemento che non soddisfa P (end() se tutti lo soddisfano)
+    */
+    template <typename P>
+    const_iterator partition_point(const P& predicate) const {
+        return std::partition_point(begin(), end(), predicate);
     }
 
-// ---------------------- FINE ITERATORE CUSTOM ----------------------
+// ---------------------- FINE INTERROGAZIONI ----------------------
 
 };
 
+/**
+ * @brief Stack che prende la memoria da una std::pmr::memory_resource
+ * (es. std::pmr::monotonic_buffer_resource per arene rilasciate in un colpo solo)
+*/
+template <typename T>
+using PmrStack = Stack<T, std::pmr::polymorphic_allocator<T>>;
+
+/**
+ * @brief Specializzazione di std::hash per usare gli Stack come chiavi di unordered_map/unordered_set
+ * 
+ * Coerente con operator==: dipende solo dal contenuto. Per T con stack_bitwise_equal
+ * (interi, enum, puntatori, ...) l'hash è calcolato direttamente sui byte del buffer contiguo,
+ * altrimenti combina std::hash<T> dei singoli elementi.
+*/
+namespace std {
+    template <typename T, typename Alloc, typename Stats, typename Check>
+    struct hash<Stack<T, Alloc, Stats, Check>> {
+        size_t operator()(const Stack<T, Alloc, Stats, Check>& s) const {
+            if constexpr (stack_bitwise_equal<T>::value) {
+                return static_cast<size_t>(stack_hash_bytes(s.data(), s.size() * sizeof(T)));
+            }
+            else {
+                uint64_t h = stack_hash_bytes(nullptr, 0, s.size());
+                for (const T& element : s) {
+                    h = (h ^ hash<T>()(element)) * 0x9E3779B185EBCA87ULL;
+                    h ^= h >> 31;
+                }
+                return static_cast<size_t>(h);
+            }
+        }
+    };
+}
+
+#undef STACK_PAR_ALGO
+
 #endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef STACK_CHECK_H
+#define STACK_CHECK_H
+
+#include <cassert>
+#include <stdexcept>
+
+/**
+ * @brief Politiche di controllo dei limiti per Stack (overflow di uno stack Fixed, underflow)
+ *
+ * enabled dice se i controlli vanno fatti: con enabled == false il confronto sparisce
+ * dal codice e violare un limite è una violazione della precondizione (comportamento
+ * non definito), come con push_unchecked()/pop_unchecked(). Lo stesso sorgente può così
+ * usare StackCheckThrow in debug e StackCheckNone in release.
+*/
+
+/**
+ * @brief Politica di default: std::length_error (il comportamento storico di Stack)
+*/
+struct StackCheckThrow {
+    static const bool enabled = true;
+
+    [[noreturn]] static void overflow(const char* what) {
+        throw std::length_error(what);
+    }
+
+    [[noreturn]] static void underflow(const char* what) {
+        throw std::length_error(what);
+    }
+};
+
+/**
+ * @brief Politica con assert: controlla solo se NDEBUG non è definita
+*/
+struct StackCheckAssert {
+#ifdef NDEBUG
+    static const bool enabled = false;
+#else
+    static const bool enabled = true;
+#endif
+
+    static void overflow(const char* what) {
+        (void)what;
+        assert(!"Stack overflow");
+    }
+
+    static void underflow(const char* what) {
+        (void)what;
+        assert(!"Stack underflow");
+    }
+};
+
+/**
+ * @brief Politica senza controlli: i limiti sono responsabilità del chiamante
+*/
+struct StackCheckNone {
+    static const bool enabled = false;
+
+    static void overflow(const char*) {}
+    static void underflow(const char*) {}
+};
+
+#endif
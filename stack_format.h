@@ -0,0 +1,185 @@
+#ifndef STACK_FORMAT_H
+#define STACK_FORMAT_H
+
+#include <charconv>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Ordine in cui StackFormatter scrive gli elementi
+ *
+ * BottomUp: dal fondo alla cima (come operator<<)
+ * TopDown: dalla cima al fondo (ordine di estrazione)
+*/
+enum class StackOrder { BottomUp, TopDown };
+
+/**
+ * @brief Trait che vale true se esiste stack_format(std::string&, const T&) trovata per ADL
+ *
+ * È il punto di personalizzazione per i tipi utente (vedi userCustom in custom.h):
+ * la funzione deve aggiungere in fondo alla stringa la rappresentazione testuale del valore.
+*/
+template <typename T, typename = void>
+struct has_stack_format : std::false_type {};
+
+template <typename T>
+struct has_stack_format<T, std::void_t<decltype(stack_format(std::declval<std::string&>(), std::declval<const T&>()))>>
+    : std::true_type {};
+
+/**
+ * @brief Formattatore testuale ad alto throughput per gli stack
+ *
+ * Scrive gli elementi in un buffer riutilizzato tra una chiamata e l'altra, quindi a regime
+ * non alloca. I tipi aritmetici passano da std::to_chars (nessuna locale, nessuno stream),
+ * tranne char, signed char e unsigned char che come con operator<< sono scritti come caratteri;
+ * le stringhe sono copiate direttamente, i tipi utente usano stack_format() se definita
+ * e altrimenti ricadono su operator<<. Lo stream di destinazione non viene mai svuotato
+ * (nessun std::endl né flush).
+ *
+ * Funziona con qualsiasi stack del progetto che abbia begin()/end() bidirezionali.
+*/
+class StackFormatter {
+
+public:
+
+    /**
+     * @brief Costruttore
+     *
+     * @param separator separatore tra due elementi
+     * @param order ordine degli elementi (di default dal fondo alla cima)
+     * @param prefix testo prima del primo elemento
+     * @param suffix testo dopo l'ultimo elemento
+    */
+    explicit StackFormatter(std::string separator = " ", StackOrder order = StackOrder::BottomUp,
+                            std::string prefix = "[ ", std::string suffix = " ]")
+        : separator_(std::move(separator)), prefix_(std::move(prefix)), suffix_(std::move(suffix)), order_(order) {}
+
+    void set_separator(std::string separator) {
+        separator_ = std::move(separator);
+    }
+
+    void set_order(StackOrder order) {
+        order_ = order;
+    }
+
+    void set_delimiters(std::string prefix, std::string suffix) {
+        prefix_ = std::move(prefix);
+        suffix_ = std::move(suffix);
+    }
+
+    /**
+     * @brief Metodo per scrivere lo stack nel buffer interno (il contenuto precedente è scartato)
+     *
+     * @param s stack da formattare
+     *
+     * @return const std::string& buffer con il testo (valido fino alla prossima chiamata)
+    */
+    template <typename S>
+    const std::string& format(const S& s) {
+        buffer_.clear();
+        append(s);
+        return buffer_;
+    }
+
+    /**
+     * @brief Metodo per aggiungere lo stack in fondo al buffer interno
+     *
+     * @param s stack da formattare
+    */
+    template <typename S>
+    void append(const S& s) {
+        typedef typename std::iterator_traits<decltype(s.begin())>::value_type value_type;
+        auto first = s.begin();
+        auto last = s.end();
+        if (first != last && std::is_arithmetic<value_type>::value)
+            buffer_.reserve(buffer_.size() + static_cast<std::size_t>(std::distance(first, last)) *
+                                                 (8 + separator_.size()));
+        buffer_ += prefix_;
+        if (order_ == StackOrder::BottomUp) {
+            for (auto it = first; it != last; ++it) {
+                if (it != first)
+                    buffer_ += separator_;
+                format_element(*it);
+            }
+        }
+        else {
+            for (auto it = last; it != first;) {
+                --it;
+                format_element(*it);
+                if (it != first)
+                    buffer_ += separator_;
+            }
+        }
+        buffer_ += suffix_;
+    }
+
+    /**
+     * @brief Metodo per formattare lo stack e scriverlo sullo stream con una sola write (senza flush)
+     *
+     * @param os stream di output
+     * @param s stack da formattare
+    */
+    template <typename S>
+    void write(std::ostream& os, const S& s) {
+        const std::string& text = format(s);
+        os.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    const std::string& buffer() const {
+        return buffer_;
+    }
+
+    void clear() {
+        buffer_.clear();
+    }
+
+private:
+    std::string buffer_;
+    std::string separator_;
+    std::string prefix_;
+    std::string suffix_;
+    StackOrder order_;
+
+    /**
+     * @brief Metodo privato che aggiunge al buffer la rappresentazione di un elemento
+     *
+     * @param value elemento da formattare
+    */
+    template <typename T>
+    void format_element(const T& value) {
+        if constexpr (std::is_same<T, bool>::value) {
+            buffer_ += value ? '1' : '0';
+        }
+        else if constexpr (std::is_same<T, char>::value || std::is_same<T, signed char>::value ||
+                           std::is_same<T, unsigned char>::value) {
+            // operator<< scrive i tipi carattere come caratteri, non come numeri
+            buffer_ += static_cast<char>(value);
+        }
+        else if constexpr (std::is_arithmetic<T>::value) {
+            char tmp[64];
+            std::to_chars_result r = std::to_chars(tmp, tmp + sizeof(tmp), value);
+            buffer_.append(tmp, r.ptr);
+        }
+        else if constexpr (std::is_convertible<const T&, std::string_view>::value) {
+            buffer_ += std::string_view(value);
+        }
+        else if constexpr (has_stack_format<T>::value) {
+            stack_format(buffer_, value);
+        }
+        else {
+            // nessuna personalizzazione: si passa da operator<< (lento, ma sempre disponibile)
+            fallback_.str(std::string());
+            fallback_ << value;
+            buffer_ += fallback_.str();
+        }
+    }
+
+    std::ostringstream fallback_;
+};
+
+#endif
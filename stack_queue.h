@@ -0,0 +1,298 @@
+#ifndef STACK_QUEUE_H
+#define STACK_QUEUE_H
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "stack.h"
+#include "aggregating_stack.h"
+
+/**
+ * @brief Aggregato opzionale di StackQueue secondo il monoide Monoid (vedi aggregating_stack.h)
+ *
+ * L'ingresso ha un solo aggregato corrente, perché i suoi elementi escono tutti insieme
+ * nel travaso. L'uscita ha per ogni cella l'aggregato dalla cella fino al fondo, calcolato
+ * al travaso: in cima c'è l'aggregato di tutta l'uscita dal più vecchio al più recente.
+*/
+template <typename T, typename Alloc, typename Monoid>
+class StackQueueAggregate {
+
+private:
+    Stack<T, Alloc> out_;   // parallelo all'uscita della coda
+    Monoid monoid_;
+    T in_;
+
+public:
+    explicit StackQueueAggregate(const Alloc& alloc)
+        : out_(0, StackGrowth::Geometric, alloc), monoid_(), in_(monoid_.identity()) {}
+
+    void push(const T& value) {
+        in_ = monoid_(in_, value);
+    }
+
+    void reserve(unsigned int n) {
+        out_.reserve(n);
+    }
+
+    /**
+     * @brief Metodo che calcola gli aggregati dell'uscita appena travasata (il più vecchio in cima)
+     *
+     * Se il monoide lancia l'aggregato resta quello di prima del travaso.
+    */
+    void transfer(const Stack<T, Alloc>& out) {
+        try {
+            for (const T& value : out) {
+                if (out_.empty())
+                    out_.push(value);
+                else
+                    out_.push(monoid_(value, out_.top()));
+            }
+        } catch (...) {
+            out_.clear();
+            throw;
+        }
+        in_ = monoid_.identity();
+    }
+
+    void pop() {
+        out_.pop_unchecked();
+    }
+
+    T aggregate(bool in_empty) const {
+        if (out_.empty())
+            return in_;
+        if (in_empty)
+            return out_.top();
+        return monoid_(out_.top(), in_);
+    }
+
+    void clear() {
+        out_.clear();
+        in_ = monoid_.identity();
+    }
+};
+
+/**
+ * @brief Nessun aggregato (Monoid = void): nessuna memoria in più, nessun costo
+*/
+template <typename T, typename Alloc>
+class StackQueueAggregate<T, Alloc, void> {
+
+public:
+    explicit StackQueueAggregate(const Alloc&) {}
+
+    void push(const T&) {}
+    void reserve(unsigned int) {}
+    void transfer(const Stack<T, Alloc>&) {}
+    void pop() {}
+    void clear() {}
+};
+
+/**
+ * @brief Coda FIFO realizzata con due Stack (ingresso e uscita), pensata per un solo produttore
+ *
+ * push() inserisce nello stack di ingresso, pop() estrae dalla cima di quello di uscita.
+ * Quando l'uscita è vuota l'ingresso le viene passato in blocco: i suoi elementi vengono
+ * invertiti sul posto e i due buffer si scambiano, senza copie elemento per elemento né
+ * allocazioni. A regime i due buffer contigui si alternano e la coda non alloca più,
+ * a differenza dei blocchi di std::deque. Ogni elemento viene invertito una volta sola:
+ * push e pop sono O(1) ammortizzati.
+ *
+ * Con un Monoid (StackSum, StackMin, StackMax, ... di aggregating_stack.h) la coda mantiene
+ * anche l'aggregato degli elementi dal più vecchio al più recente, letto in O(1) con
+ * aggregate(): l'aggregato dell'uscita è ricalcolato al travaso, quindi il costo resta O(1)
+ * ammortizzato per elemento. Con Monoid = void (default) non c'è nessun aggregato.
+ * WindowAggregator di aggregating_stack.h fa lo stesso travasando elemento per elemento.
+ * Non è thread-safe.
+*/
+template <typename T, typename Alloc = std::allocator<T>, typename Monoid = void>
+class StackQueue {
+
+private:
+    Stack<T, Alloc> in_;      // elementi più recenti, il più nuovo in cima
+    Stack<T, Alloc> out_;     // elementi più vecchi, il più vecchio in cima
+    StackQueueAggregate<T, Alloc, Monoid> agg_;
+
+    /**
+     * @brief Metodo privato che passa in blocco l'ingresso (non vuoto) all'uscita (vuota)
+     *
+     * Se il calcolo dell'aggregato lancia, la coda torna com'era prima del travaso.
+    */
+    void transfer() {
+        agg_.reserve(in_.size());
+        std::reverse(in_.begin(), in_.end());
+        in_.swap(out_);
+        try {
+            agg_.transfer(out_);
+        } catch (...) {
+            out_.swap(in_);
+            std::reverse(in_.begin(), in_.end());
+            throw;
+        }
+    }
+
+    /**
+     * @brief Metodo privato che aggiorna l'aggregato con gli elementi dell'ingresso da first in su
+     *
+     * Se il monoide lancia, gli elementi appena inseriti vengono tolti.
+    */
+    void pushed(unsigned int first) {
+        unsigned int i = first;
+        try {
+            for (; i < in_.size(); ++i) {
+                agg_.push(in_.begin()[i]);
+            }
+        } catch (...) {
+            while (in_.size() > first) {
+                in_.pop_unchecked();
+            }
+            throw;
+        }
+    }
+
+public:
+    typedef T value_type;
+
+    /**
+     * @brief Costruttore di default (coda vuota)
+     *
+     * @param capacity capacità iniziale di ciascuno dei due stack (crescono in modo geometrico)
+     * @param alloc allocatore da cui prendere la memoria
+    */
+    explicit StackQueue(unsigned int capacity = 0, const Alloc& alloc = Alloc())
+        : in_(capacity, StackGrowth::Geometric, alloc), out_(capacity, StackGrowth::Geometric, alloc), agg_(alloc) {}
+
+    /**
+     * @brief Metodo per inserire un elemento in fondo alla coda
+     *
+     * @param value valore da inserire
+    */
+    void push(const T& value) {
+        in_.push(value);
+        pushed(in_.size() - 1);
+    }
+
+    void push(T&& value) {
+        in_.push(std::move(value));
+        pushed(in_.size() - 1);
+    }
+
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        in_.emplace(std::forward<Args>(args)...);
+        pushed(in_.size() - 1);
+        return in_.top();
+    }
+
+    /**
+     * @brief Metodo per inserire in fondo alla coda una sequenza di elementi (il primo esce per primo)
+    */
+    template <typename Iter>
+    void push_range(Iter first, Iter last) {
+        unsigned int n = in_.size();
+        in_.push_range(first, last);
+        pushed(n);
+    }
+
+    /**
+     * @brief Metodo per rimuovere l'elemento più vecchio e restituirlo
+     *
+     * @throw std::length_error se la coda è vuota
+     *
+     * @return T elemento rimosso
+    */
+    T pop() {
+        if (out_.empty()) {
+            if (in_.empty())
+                throw std::length_error("StackQueue underflow in pop (queue empty)");
+            transfer();
+        }
+        T value(out_.pop_unchecked());
+        agg_.pop();
+        return value;
+    }
+
+    /**
+     * @brief Metodo per rimuovere fino a n elementi (dal più vecchio) e scriverli in out
+     *
+     * @return OutIter iteratore di output dopo l'ultimo elemento scritto
+    */
+    template <typename OutIter>
+    OutIter pop_n(unsigned int n, OutIter out) {
+        while (n > 0 && !empty()) {
+            if (out_.empty())
+                transfer();
+            unsigned int k = std::min(n, out_.size());
+            for (unsigned int i = 0; i < k; ++i, ++out) {
+                *out = out_.pop_unchecked();
+                agg_.pop();
+            }
+            n -= k;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Metodo che restituisce l'elemento più vecchio (senza travasi)
+     *
+     * @throw std::length_error se la coda è vuota
+    */
+    const T& front() const {
+        if (!out_.empty())
+            return out_.top();
+        if (in_.empty())
+            throw std::length_error("StackQueue underflow in front (queue empty)");
+        return *in_.begin();
+    }
+
+    /**
+     * @brief Metodo che restituisce l'elemento più recente
+     *
+     * @throw std::length_error se la coda è vuota
+    */
+    const T& back() const {
+        if (!in_.empty())
+            return in_.top();
+        if (out_.empty())
+            throw std::length_error("StackQueue underflow in back (queue empty)");
+        return *out_.begin();
+    }
+
+    /**
+     * @brief Metodo che restituisce l'aggregato della coda, dal più vecchio al più recente (O(1))
+     *
+     * Disponibile solo con un Monoid.
+     *
+     * @return T aggregato, o Monoid().identity() se la coda è vuota
+    */
+    T aggregate() const {
+        static_assert(!std::is_void<Monoid>::value, "StackQueue: aggregate() richiede un Monoid");
+        return agg_.aggregate(in_.empty());
+    }
+
+    void clear() {
+        in_.clear();
+        out_.clear();
+        agg_.clear();
+    }
+
+    bool empty() const {
+        return in_.empty() && out_.empty();
+    }
+
+    unsigned int size() const {
+        return in_.size() + out_.size();
+    }
+
+    /**
+     * @brief Metodo per riservare spazio per n elementi in ciascuno dei due stack
+    */
+    void reserve(unsigned int n) {
+        in_.reserve(n);
+        out_.reserve(n);
+    }
+};
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef STACK_STATS_H
+#define STACK_STATS_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+/**
+ * @brief Contatori di utilizzo di uno stack (o la somma di più stack)
+*/
+struct StackCounters {
+    std::uint64_t pushes = 0;
+    std::uint64_t pops = 0;
+    std::uint64_t tops = 0;
+    std::uint64_t high_water = 0;       // massimo numero di elementi contemporaneamente presenti
+    std::uint64_t overflows = 0;        // eccezioni di overflow lanciate
+    std::uint64_t underflows = 0;       // eccezioni di underflow lanciate
+    std::uint64_t reallocations = 0;
+    std::uint64_t bytes_allocated = 0;
+    std::uint64_t instances = 1;        // stack che hanno contribuito ai contatori
+
+    /**
+     * @brief Metodo per sommare i contatori di un altro stack (l'high-water mark è il massimo)
+    */
+    void merge(const StackCounters& other) {
+        pushes += other.pushes;
+        pops += other.pops;
+        tops += other.tops;
+        if (other.high_water > high_water)
+            high_water = other.high_water;
+        overflows += other.overflows;
+        underflows += other.underflows;
+        reallocations += other.reallocations;
+        bytes_allocated += other.bytes_allocated;
+        instances += other.instances;
+    }
+
+    /**
+     * @brief Metodo per stampare i contatori su una riga
+    */
+    friend std::ostream& operator<<(std::ostream& os, const StackCounters& c) {
+        os << "push=" << c.pushes << " pop=" << c.pops << " top=" << c.tops
+           << " high_water=" << c.high_water << " overflow=" << c.overflows
+           << " underflow=" << c.underflows << " realloc=" << c.reallocations
+           << " bytes=" << c.bytes_allocated << " stack=" << c.instances;
+        return os;
+    }
+};
+
+/**
+ * @brief Registro di processo dei contatori, raggruppati per nome (thread-safe)
+ *
+ * Uno StackStats con un nome vi somma i propri contatori quando viene distrutto
+ * (o con publish()), quindi il registro contiene i totali di tutti gli stack con quel nome.
+*/
+class StackStatsRegistry {
+
+public:
+
+    static StackStatsRegistry& instance() {
+        static StackStatsRegistry registry;
+        return registry;
+    }
+
+    void add(const std::string& name, const StackCounters& counters) {
+        std::lock_guard<std::mutex> lock(m_);
+        auto it = totals_.find(name);
+        if (it == totals_.end())
+            totals_.emplace(name, counters);
+        else
+            it->second.merge(counters);
+    }
+
+    /**
+     * @brief Metodo per leggere i totali registrati con un nome
+     *
+     * @return StackCounters totali (instances == 0 se il nome non è registrato)
+    */
+    StackCounters get(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(m_);
+        auto it = totals_.find(name);
+        if (it != totals_.end())
+            return it->second;
+        StackCounters none;
+        none.instances = 0;
+        return none;
+    }
+
+    /**
+     * @brief Metodo per stampare tutti i totali, un nome per riga
+    */
+    void dump(std::ostream& os) const {
+        std::lock_guard<std::mutex> lock(m_);
+        for (const auto& entry : totals_) {
+            os << entry.first << ": " << entry.second << '\n';
+        }
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(m_);
+        totals_.clear();
+    }
+
+private:
+    StackStatsRegistry() {}
+
+    mutable std::mutex m_;
+    std::map<std::string, StackCounters> totals_;
+};
+
+/**
+ * @brief Politica di strumentazione di default: nessun contatore
+ *
+ * Tutti i metodi sono vuoti e inline, quindi il compilatore li elimina del tutto.
+*/
+struct NoStackStats {
+    static const bool enabled = false;
+
+    void on_push(unsigned int, unsigned int) {}
+    void on_pop(unsigned int) {}
+    void on_top() {}
+    void on_size(unsigned int) {}
+    void on_overflow() {}
+    void on_underflow() {}
+    void on_allocate(std::size_t) {}
+    void on_reallocate() {}
+};
+
+/**
+ * @brief Politica di strumentazione che conta le operazioni di uno stack
+ *
+ * I contatori appartengono all'oggetto stack, non al contenuto: copie, spostamenti e
+ * swap non li trasferiscono. Non sono atomici, come lo stack stesso.
+ * Se viene dato un nome con set_name(), alla distruzione i contatori vengono sommati
+ * nello StackStatsRegistry di processo sotto quel nome.
+*/
+class StackStats {
+
+public:
+    static const bool enabled = true;
+
+    StackStats() {}
+
+    // la copia di uno stack parte con contatori propri, ma riporta sotto lo stesso nome
+    StackStats(const StackStats& other) : name_(other.name_) {}
+
+    StackStats& operator=(const StackStats&) {
+        return *this;
+    }
+
+    ~StackStats() {
+        publish();
+    }
+
+    void on_push(unsigned int n, unsigned int top) {
+        counters_.pushes += n;
+        on_size(top);
+    }
+
+    void on_pop(unsigned int n) {
+        counters_.pops += n;
+    }
+
+    void on_top() {
+        ++counters_.tops;
+    }
+
+    void on_size(unsigned int top) {
+        if (top > counters_.high_water)
+            counters_.high_water = top;
+    }
+
+    void on_overflow() {
+        ++counters_.overflows;
+    }
+
+    void on_underflow() {
+        ++counters_.underflows;
+    }
+
+    void on_allocate(std::size_t bytes) {
+        counters_.bytes_allocated += bytes;
+    }
+
+    void on_reallocate() {
+        ++counters_.reallocations;
+    }
+
+    const StackCounters& counters() const {
+        return counters_;
+    }
+
+    const std::string& name() const {
+        return name_;
+    }
+
+    void set_name(std::string name) {
+        name_ = std::move(name);
+    }
+
+    /**
+     * @brief Metodo per sommare i contatori nel registro (se c'è un nome) e azzerarli
+    */
+    void publish() {
+        if (!name_.empty())
+            StackStatsRegistry::instance().add(name_, counters_);
+        counters_ = StackCounters();
+        counters_.instances = 0;    // questo stack è già stato contato
+    }
+
+    /**
+     * @brief Metodo per stampare i contatori di questo stack
+    */
+    void dump(std::ostream& os) const {
+        os << (name_.empty() ? "stack" : name_) << ": " << counters_ << '\n';
+    }
+
+private:
+    StackCounters counters_;
+    std::string name_;
+};
+
+#endif
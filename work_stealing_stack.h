@@ -0,0 +1,189 @@
+#ifndef WORK_STEALING_STACK_H
+#define WORK_STEALING_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Stack per-thread con furto di lavoro (deque di Chase-Lev)
+ *
+ * Il thread proprietario inserisce ed estrae in ordine LIFO dalla cima (push/try_pop),
+ * come con Stack; gli altri thread rubano in ordine FIFO dal fondo (try_steal).
+ * Gli elementi stanno in un array contiguo circolare (capacità potenza di 2) che
+ * raddoppia quando è pieno. Gli array sostituiti restano vivi fino alla distruzione
+ * perché un ladro potrebbe ancora leggerli.
+ *
+ * Il cammino veloce del proprietario usa solo load/store relaxed: push aggiunge una
+ * fence release, try_pop una fence seq_cst e una CAS solo quando resta un elemento
+ * conteso con i ladri (algoritmo di Lê, Pop, Cohen, Zappa Nardelli, PPoPP 2013).
+ *
+ * T deve essere trivially copyable (tipicamente un puntatore o un indice di task).
+*/
+template <typename T>
+class WorkStealingStack {
+
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "WorkStealingStack: T deve essere trivially copyable");
+
+private:
+
+    /**
+     * @brief Array circolare di celle atomiche (letto anche dai ladri)
+    */
+    struct Array {
+        std::int64_t size;
+        std::int64_t mask;
+        std::atomic<T>* cells;
+
+        explicit Array(std::int64_t n) : size(n), mask(n - 1), cells(new std::atomic<T>[n]) {}
+
+        ~Array() {
+            delete[] cells;
+        }
+
+        T get(std::int64_t i) const {
+            return cells[i & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t i, const T& value) {
+            cells[i & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    // cima e fondo su linee di cache diverse per evitare false sharing tra proprietario e ladri
+    alignas(64) std::atomic<std::int64_t> top_;
+    alignas(64) std::atomic<std::int64_t> bottom_;
+    alignas(64) std::atomic<Array*> array_;
+    std::vector<Array*> retired_;   // usato solo dal proprietario
+
+    /**
+     * @brief Metodo privato che raddoppia la capacità (solo proprietario)
+    */
+    Array* grow(Array* old, std::int64_t bottom, std::int64_t top) {
+        Array* a = new Array(old->size * 2);
+        for (std::int64_t i = bottom; i < top; ++i) {
+            a->put(i, old->get(i));
+        }
+        retired_.push_back(old);
+        array_.store(a, std::memory_order_release);
+        return a;
+    }
+
+public:
+
+    /**
+     * @brief Costruttore
+     *
+     * @param capacity capacità iniziale (arrotondata alla potenza di 2 successiva)
+    */
+    explicit WorkStealingStack(unsigned int capacity = 64) : top_(0), bottom_(0) {
+        std::int64_t n = 2;
+        while (n < capacity) {
+            n *= 2;
+        }
+        array_.store(new Array(n), std::memory_order_relaxed);
+    }
+
+    WorkStealingStack(const WorkStealingStack&) = delete;
+    WorkStealingStack& operator=(const WorkStealingStack&) = delete;
+
+    /**
+     * @brief Distruttore (nessun altro thread deve usare lo stack)
+    */
+    ~WorkStealingStack() {
+        delete array_.load(std::memory_order_relaxed);
+        for (Array* a : retired_) {
+            delete a;
+        }
+    }
+
+    /**
+     * @brief Metodo per inserire un elemento in cima (solo proprietario)
+     *
+     * @param value valore da inserire
+     *
+     * @throw std::bad_alloc se non è possibile far crescere l'array
+    */
+    void push(const T& value) {
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+        std::int64_t b = bottom_.load(std::memory_order_acquire);
+        Array* a = array_.load(std::memory_order_relaxed);
+        if (t - b > a->size - 1)
+            a = grow(a, b, t);
+        a->put(t, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        top_.store(t + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Metodo per estrarre l'elemento in cima (solo proprietario, ordine LIFO)
+     *
+     * @return std::optional<T> elemento estratto (vuoto se lo stack è vuoto)
+    */
+    std::optional<T> try_pop() {
+        std::int64_t t = top_.load(std::memory_order_relaxed) - 1;
+        Array* a = array_.load(std::memory_order_relaxed);
+        top_.store(t, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        if (b > t) {
+            // vuoto
+            top_.store(t + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        T value = a->get(t);
+        if (b == t) {
+            // ultimo elemento: si contende con i ladri
+            bool won = bottom_.compare_exchange_strong(b, b + 1, std::memory_order_seq_cst,
+                                                       std::memory_order_relaxed);
+            top_.store(t + 1, std::memory_order_relaxed);
+            if (!won)
+                return std::nullopt;
+        }
+        return value;
+    }
+
+    /**
+     * @brief Metodo per rubare l'elemento sul fondo (qualsiasi thread, ordine FIFO)
+     *
+     * @return std::optional<T> elemento rubato (vuoto se lo stack è vuoto o il furto è stato conteso)
+    */
+    std::optional<T> try_steal() {
+        std::int64_t b = bottom_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        if (b >= t)
+            return std::nullopt;
+        Array* a = array_.load(std::memory_order_acquire);
+        T value = a->get(b);
+        if (!bottom_.compare_exchange_strong(b, b + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed))
+            return std::nullopt;
+        return value;
+    }
+
+    /**
+     * @brief Metodo per ottenere il numero di elementi (istantanea, può cambiare subito dopo)
+     *
+     * @return unsigned int numero di elementi
+    */
+    unsigned int size() const {
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        return t > b ? static_cast<unsigned int>(t - b) : 0;
+    }
+
+    /**
+     * @brief Metodo per verificare se lo stack è vuoto (istantanea, può cambiare subito dopo)
+     *
+     * @return true se lo stack è vuoto
+    */
+    bool empty() const {
+        return size() == 0;
+    }
+};
+
+#endif